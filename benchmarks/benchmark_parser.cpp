@@ -10,11 +10,20 @@
  */
 
 #include <benchmark/benchmark.h>
+#include "field_batch.hpp"
+#include "framer.hpp"
+#include "parallel_parser.hpp"
+#include "pipeline.hpp"
+#include "shard_router.hpp"
 #include "parser.hpp"
 #include "simd_utils.hpp"
 #include "benchmark_utils.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
+#include <unordered_map>
 
 using namespace simd_parser;
 using namespace benchmark_utils;
@@ -51,6 +60,98 @@ static void BM_Find_Delimiters_SIMD(benchmark::State& state) {
 }
 BENCHMARK(BM_Find_Delimiters_SIMD);
 
+// Benchmark SIMD delimiter finding into a preallocated 32-bit buffer
+static void BM_Find_Delimiters_SIMD_Span(benchmark::State& state) {
+    const std::string& msg = MEDIUM_MESSAGE;
+    uint32_t positions[64];
+
+    for (auto _ : state) {
+        size_t count = find_delimiters_simd(msg, '|', std::span<uint32_t>(positions));
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(positions);
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Find_Delimiters_SIMD_Span);
+
+// Benchmark each SIMD tier the host supports on the same input
+static void BM_Find_Delimiters_Tier(benchmark::State& state) {
+    const auto level = static_cast<SimdLevel>(state.range(0));
+    if (cpu_features().best_level() < level) {
+        state.SkipWithError("SIMD tier not supported on this CPU");
+        return;
+    }
+
+    std::vector<size_t> (*finder)(std::string_view, char) = find_delimiters_scalar;
+    switch (level) {
+        case SimdLevel::AVX512VBMI2: finder = find_delimiters_avx512_vbmi2; break;
+        case SimdLevel::AVX512: finder = find_delimiters_avx512; break;
+        case SimdLevel::AVX2:   finder = find_delimiters_avx2; break;
+        case SimdLevel::SSE42:  finder = find_delimiters_sse42; break;
+        case SimdLevel::Scalar: break;
+    }
+    state.SetLabel(simd_level_name(level));
+
+    const std::string& msg = LARGE_MESSAGE;
+    for (auto _ : state) {
+        auto positions = finder(msg, '|');
+        benchmark::DoNotOptimize(positions);
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Find_Delimiters_Tier)
+    ->Arg(static_cast<int>(SimdLevel::Scalar))
+    ->Arg(static_cast<int>(SimdLevel::SSE42))
+    ->Arg(static_cast<int>(SimdLevel::AVX2))
+    ->Arg(static_cast<int>(SimdLevel::AVX512))
+    ->Arg(static_cast<int>(SimdLevel::AVX512VBMI2));
+
+// Benchmark span-based position extraction per tier on a 4KB stream
+// (ctz loop on AVX-512 and below, vpcompressb on AVX-512 VBMI2)
+static void BM_Find_Delimiters_Span_Tier(benchmark::State& state) {
+    const auto level = static_cast<SimdLevel>(state.range(0));
+    if (cpu_features().best_level() < level) {
+        state.SkipWithError("SIMD tier not supported on this CPU");
+        return;
+    }
+    state.SetLabel(simd_level_name(level));
+
+    std::string data = generate_message_stream(4096);
+    std::vector<uint32_t> positions(data.size());
+
+    for (auto _ : state) {
+        size_t count = find_delimiters_simd(data, '|', std::span<uint32_t>(positions), level);
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(positions.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Find_Delimiters_Span_Tier)
+    ->Arg(static_cast<int>(SimdLevel::AVX2))
+    ->Arg(static_cast<int>(SimdLevel::AVX512))
+    ->Arg(static_cast<int>(SimdLevel::AVX512VBMI2));
+
+// Benchmark stage-1 structural indexing (bitmasks only, no positions)
+static void BM_Structural_Index(benchmark::State& state) {
+    const std::string& msg = MEDIUM_MESSAGE;
+    StructuralIndex index;
+
+    for (auto _ : state) {
+        build_structural_index(msg, '|', index);
+        benchmark::DoNotOptimize(index.delimiter_masks.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Structural_Index);
+
 // Benchmark delimiter finding with varying string sizes
 static void BM_Find_Delimiters_Scalar_Size(benchmark::State& state) {
     const size_t size = state.range(0);
@@ -150,6 +251,21 @@ static void BM_Parse_SIMD_Medium(benchmark::State& state) {
 }
 BENCHMARK(BM_Parse_SIMD_Medium);
 
+// Benchmark SIMD parsing of a wire-format (SOH-delimited) message
+static void BM_Parse_SIMD_Medium_SOH(benchmark::State& state) {
+    std::string msg = MEDIUM_MESSAGE;
+    std::replace(msg.begin(), msg.end(), '|', SOH);
+
+    for (auto _ : state) {
+        auto result = parse_simd<SOH>(msg);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_SIMD_Medium_SOH);
+
 // Benchmark scalar parsing - large message
 static void BM_Parse_Scalar_Large(benchmark::State& state) {
     const std::string& msg = LARGE_MESSAGE;
@@ -178,6 +294,21 @@ static void BM_Parse_SIMD_Large(benchmark::State& state) {
 }
 BENCHMARK(BM_Parse_SIMD_Large);
 
+// Benchmark SIMD parsing with a caller-owned context (no allocations)
+static void BM_Parse_SIMD_Context(benchmark::State& state) {
+    const std::string& msg = MEDIUM_MESSAGE;
+    ParserContext context;
+
+    for (auto _ : state) {
+        auto result = parse_simd(msg, context);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_SIMD_Context);
+
 // Benchmark auto-detection parsing (typical usage)
 static void BM_Parse_Auto(benchmark::State& state) {
     const std::string& msg = MEDIUM_MESSAGE;
@@ -226,6 +357,56 @@ static void BM_Parse_Int_Size(benchmark::State& state) {
 }
 BENCHMARK(BM_Parse_Int_Size)->Arg(1)->Arg(3)->Arg(5)->Arg(7)->Arg(9);
 
+// Benchmark 64-bit integer parsing (AVX-512 kernel up to 16 digits)
+static void BM_Parse_Int64_Size(benchmark::State& state) {
+    const int digits = state.range(0);
+    std::string int_str;
+    for (int i = 0; i < digits; ++i) {
+        int_str += '0' + ((i + 1) % 10);
+    }
+
+    for (auto _ : state) {
+        auto result = parse_int64(int_str);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_Int64_Size)->Arg(4)->Arg(9)->Arg(12)->Arg(16)->Arg(18);
+
+// Benchmark UTCTimestamp conversion: SSE4.2 kernel vs scalar digit loop
+static void BM_Parse_Timestamp(benchmark::State& state) {
+    const std::string_view timestamp = "20240115-14:30:00.123";
+    const bool simd = state.range(0) != 0;
+
+    for (auto _ : state) {
+        int64_t nanos = 0;
+        bool ok = simd ? parse_timestamp(timestamp, nanos) : parse_timestamp_scalar(timestamp, nanos);
+        benchmark::DoNotOptimize(ok);
+        benchmark::DoNotOptimize(nanos);
+    }
+
+    state.SetLabel(simd ? "simd" : "scalar");
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_Timestamp)->Arg(0)->Arg(1);
+
+// Benchmark tag number conversion for a typical mix of tag widths
+static void BM_Parse_Tag(benchmark::State& state) {
+    const std::string_view tags[] = {"8", "9", "35", "49", "56", "34", "52", "55", "54", "38", "44", "10"};
+
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (std::string_view tag : tags) {
+            sum += parse_tag(tag);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(tags));
+}
+BENCHMARK(BM_Parse_Tag);
+
 // Benchmark double parsing
 static void BM_Parse_Double(benchmark::State& state) {
     std::string_view double_str = "12345.67";
@@ -256,6 +437,36 @@ static void BM_Parse_Double_Precision(benchmark::State& state) {
 }
 BENCHMARK(BM_Parse_Double_Precision)->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8);
 
+// Benchmark exact decimal parsing (SWAR, no floating point)
+static void BM_Parse_Decimal(benchmark::State& state) {
+    std::string_view decimal_str = "12345.67";
+
+    for (auto _ : state) {
+        auto result = parse_decimal(decimal_str);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_Decimal);
+
+// Benchmark exact decimal parsing - various precision
+static void BM_Parse_Decimal_Precision(benchmark::State& state) {
+    const int precision = state.range(0);
+    std::string decimal_str = "12345.";
+    for (int i = 0; i < precision; ++i) {
+        decimal_str += '0' + ((i + 1) % 10);
+    }
+
+    for (auto _ : state) {
+        auto result = parse_decimal(decimal_str);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_Decimal_Precision)->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8);
+
 // ============================================================================
 // THROUGHPUT BENCHMARKS
 // ============================================================================
@@ -300,6 +511,542 @@ BENCHMARK(BM_Throughput_SIMD)
     ->Arg(1000)
     ->Arg(10000);
 
+// Batch throughput - SIMD, numeric fields converted across messages
+static void BM_Throughput_SIMD_Batch(benchmark::State& state) {
+    const size_t batch_size = state.range(0);
+    auto storage = generate_message_batch(batch_size);
+    std::vector<std::string_view> messages(storage.begin(), storage.end());
+    std::vector<FIXMessage> results(batch_size);
+    ParserContext context;
+
+    for (auto _ : state) {
+        parse_simd_batch(messages, context, results);
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+BENCHMARK(BM_Throughput_SIMD_Batch)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+// Batch throughput - parse_simd_batch chunks on N worker threads
+static void BM_Throughput_Parallel(benchmark::State& state) {
+    const size_t batch_size = 65536;
+    auto storage = generate_message_batch(batch_size);
+    std::vector<std::string_view> messages(storage.begin(), storage.end());
+    std::vector<FIXMessage> results(batch_size);
+    ParallelParser parser(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto stats = parser.parse(messages, results);
+        benchmark::DoNotOptimize(stats);
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+BENCHMARK(BM_Throughput_Parallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+// Price conversion one call per value vs. one batched call
+static void BM_Parse_Price_Loop(benchmark::State& state) {
+    auto storage = generate_price_strings(1024);
+    std::vector<std::string_view> values(storage.begin(), storage.end());
+    std::vector<double> prices(values.size());
+    std::vector<Decimal64> decimals(values.size());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < values.size(); ++i) {
+            prices[i] = parse_price(values[i], decimals[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_Parse_Price_Loop);
+
+static void BM_Parse_Price_Batch(benchmark::State& state) {
+    auto storage = generate_price_strings(1024);
+    std::vector<std::string_view> values(storage.begin(), storage.end());
+    std::vector<double> prices(values.size());
+    std::vector<Decimal64> decimals(values.size());
+
+    for (auto _ : state) {
+        parse_price_batch(values, prices, decimals);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_Parse_Price_Batch);
+
+// ============================================================================
+// CHECKSUM BENCHMARKS
+// ============================================================================
+
+// Benchmark scalar checksum with varying sizes
+static void BM_Checksum_Scalar(benchmark::State& state) {
+    std::string data = generate_message_stream(state.range(0));
+
+    for (auto _ : state) {
+        auto result = compute_checksum_scalar(data);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Checksum_Scalar)->Arg(64)->Arg(256)->Arg(4096);
+
+// Benchmark SAD-based checksum with varying sizes
+static void BM_Checksum_SIMD(benchmark::State& state) {
+    std::string data = generate_message_stream(state.range(0));
+
+    for (auto _ : state) {
+        auto result = compute_checksum_simd(data);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Checksum_SIMD)->Arg(64)->Arg(256)->Arg(4096);
+
+// Parse a message carrying a CheckSum trailer (validated from the stage-1 sum)
+static void BM_Parse_SIMD_Medium_Checksum(benchmark::State& state) {
+    std::string msg = MEDIUM_MESSAGE;
+    msg += "10=" + std::to_string(1000 + compute_checksum_scalar(msg)).substr(1) + "|";
+
+    for (auto _ : state) {
+        auto result = parse_simd(msg);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_SIMD_Medium_Checksum);
+
+// Parse while recording every field for later lookups (compare BM_Parse_SIMD_Medium)
+static void BM_Parse_SIMD_Medium_Indexed(benchmark::State& state) {
+    ParserContext context;
+    FieldIndex fields;
+
+    for (auto _ : state) {
+        auto result = parse_simd(MEDIUM_MESSAGE, context, fields);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(fields.get(49));
+    }
+
+    state.SetBytesProcessed(state.iterations() * MEDIUM_MESSAGE.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_SIMD_Medium_Indexed);
+
+// Full parse of a long execution report
+static void BM_Parse_SIMD_ExecReport(benchmark::State& state) {
+    const std::string& msg = EXECUTION_REPORT_MESSAGE;
+
+    for (auto _ : state) {
+        auto result = parse_simd(msg);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_SIMD_ExecReport);
+
+// Pre-trade filter on the same report: only 35 and 55, stopping once both are seen
+static void BM_Parse_SIMD_ExecReport_FieldMask(benchmark::State& state) {
+    const std::string& msg = EXECUTION_REPORT_MESSAGE;
+    const FieldMask fields{FIXTag::MessageType, FIXTag::Symbol};
+
+    for (auto _ : state) {
+        auto result = parse_simd(msg, fields);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_SIMD_ExecReport_FieldMask);
+
+// Routing consumer: reads MsgType and TargetCompID only, no numeric conversion
+static void BM_Parse_Lazy_Medium_Routing(benchmark::State& state) {
+    for (auto _ : state) {
+        auto result = parse_lazy(MEDIUM_MESSAGE);
+        benchmark::DoNotOptimize(result.message_type());
+        benchmark::DoNotOptimize(result.target());
+    }
+
+    state.SetBytesProcessed(state.iterations() * MEDIUM_MESSAGE.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_Lazy_Medium_Routing);
+
+// Lazy parse that reads every numeric field (worst case vs BM_Parse_SIMD_Medium)
+static void BM_Parse_Lazy_Medium_AllFields(benchmark::State& state) {
+    for (auto _ : state) {
+        auto result = parse_lazy(MEDIUM_MESSAGE);
+        benchmark::DoNotOptimize(result.side());
+        benchmark::DoNotOptimize(result.price());
+        benchmark::DoNotOptimize(result.quantity());
+    }
+
+    state.SetBytesProcessed(state.iterations() * MEDIUM_MESSAGE.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_Lazy_Medium_AllFields);
+
+// ============================================================================
+// SYMBOL INTERNING BENCHMARKS
+// ============================================================================
+
+// Symbol -> id for a 500-instrument universe: SymbolTable vs a string-keyed hash map
+static void BM_Symbol_Lookup(benchmark::State& state) {
+    const bool use_table = state.range(0) == 0;
+    std::vector<std::string> universe;
+    for (size_t i = 0; i < 500; ++i) {
+        std::string symbol(1, static_cast<char>('A' + i % 26));
+        universe.push_back(symbol.append(std::to_string(i)));
+    }
+
+    SymbolTable table;
+    std::unordered_map<std::string_view, uint32_t> map;
+    for (const std::string& symbol : universe) {
+        map.emplace(symbol, table.intern(symbol));
+    }
+
+    // Lookups in a fixed pseudo-random order
+    std::vector<std::string_view> lookups;
+    for (size_t i = 0; i < 1024; ++i) {
+        lookups.push_back(universe[(i * 7919) % universe.size()]);
+    }
+
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (std::string_view symbol : lookups) {
+            sum += use_table ? table.find(symbol) : map.find(symbol)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetLabel(use_table ? "SymbolTable" : "unordered_map");
+    state.SetItemsProcessed(state.iterations() * lookups.size());
+}
+BENCHMARK(BM_Symbol_Lookup)->Arg(0)->Arg(1);
+
+// Parse with symbol_id filled in (compare BM_Parse_SIMD_Context)
+static void BM_Parse_SIMD_Medium_Interned(benchmark::State& state) {
+    SymbolTable symbols;
+    ParserContext context;
+    context.symbols = &symbols;
+
+    for (auto _ : state) {
+        auto result = parse_simd(MEDIUM_MESSAGE, context);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * MEDIUM_MESSAGE.size());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse_SIMD_Medium_Interned);
+
+// ============================================================================
+// STREAM FRAMING BENCHMARKS
+// ============================================================================
+
+// Split the two messages glued together in XLARGE_MESSAGE
+static void BM_Frame_XLarge(benchmark::State& state) {
+    const std::string& buffer = XLARGE_MESSAGE;
+    std::string_view out[4];
+
+    for (auto _ : state) {
+        auto result = frame_messages(buffer, out, true);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(out);
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+BENCHMARK(BM_Frame_XLarge);
+
+// Frame a full recv buffer of back-to-back messages
+static void BM_Frame_Stream(benchmark::State& state) {
+    std::string buffer = generate_message_stream(state.range(0));
+    std::vector<std::string_view> out(buffer.size() / 16);
+    size_t messages = 0;
+
+    for (auto _ : state) {
+        auto result = frame_messages(buffer, out, true);
+        benchmark::DoNotOptimize(out.data());
+        messages = result.message_count;
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Frame_Stream)->Arg(4096)->Arg(65536);
+
+// Frame a recv buffer from BodyLength headers alone (bodies are skipped)
+static void BM_Frame_By_Length_Stream(benchmark::State& state) {
+    std::string buffer = generate_framed_message_stream(state.range(0));
+    std::vector<std::string_view> out(buffer.size() / 16);
+    size_t messages = 0;
+
+    for (auto _ : state) {
+        auto result = frame_messages_by_length(buffer, out);
+        benchmark::DoNotOptimize(out.data());
+        messages = result.message_count;
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Frame_By_Length_Stream)->Arg(4096)->Arg(65536);
+
+// Frame a recv buffer and parse every message in it
+static void BM_Frame_And_Parse_Stream(benchmark::State& state) {
+    std::string buffer = generate_message_stream(65536);
+    std::vector<std::string_view> out(buffer.size() / 16);
+    ParserContext context;
+    size_t messages = 0;
+
+    for (auto _ : state) {
+        auto framed = frame_messages(buffer, out, true);
+        for (size_t i = 0; i < framed.message_count; ++i) {
+            auto result = parse_simd(out[i], context);
+            benchmark::DoNotOptimize(result);
+        }
+        messages = framed.message_count;
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Frame_And_Parse_Stream);
+
+// Same buffer framed and parsed into struct-of-arrays columns in one call
+static void BM_Parse_Batch_Stream(benchmark::State& state) {
+    std::string buffer = generate_message_stream(65536);
+    ParserContext context;
+    MessageBatch batch(buffer.size() / 16);
+    size_t messages = 0;
+
+    for (auto _ : state) {
+        auto result = parse_batch(buffer, context, batch, true);
+        benchmark::DoNotOptimize(batch.prices.data());
+        benchmark::ClobberMemory();
+        messages = result.message_count;
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Parse_Batch_Stream);
+
+// A 4 MB log buffer cut into ~64 KB chunks, framed and parsed on N threads
+static void BM_Parse_Buffer_Parallel(benchmark::State& state) {
+    std::string buffer = generate_message_stream(4 << 20);
+    std::vector<FIXMessage> results;
+    ParallelParser parser(static_cast<size_t>(state.range(0)));
+    size_t messages = 0;
+
+    for (auto _ : state) {
+        auto stats = parser.parse_buffer(buffer, results);
+        benchmark::DoNotOptimize(results.data());
+        messages = stats.messages();
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Parse_Buffer_Parallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+// A 4 MB stream fed 64 KB per read through ingest -> N parsers -> consumer
+static void BM_Pipeline_Stream(benchmark::State& state) {
+    std::string buffer = generate_message_stream(4 << 20);
+    PipelineOptions options;
+    options.parser_threads = static_cast<size_t>(state.range(0));
+    ParsePipeline pipeline(options);
+    size_t messages = 0;
+    double notional = 0;
+
+    for (auto _ : state) {
+        size_t offset = 0;
+        auto source = [&](std::span<char> out) {
+            const size_t count = std::min({out.size(), buffer.size() - offset, size_t(64 * 1024)});
+            std::memcpy(out.data(), buffer.data() + offset, count);
+            offset += count;
+            return count;
+        };
+        auto stats = pipeline.run(source, [&](std::span<const ParsedRecord> records) {
+            for (const ParsedRecord& record : records) {
+                notional += record.message.price() * record.message.quantity;
+            }
+        });
+        messages = stats.messages;
+    }
+    benchmark::DoNotOptimize(notional);
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Pipeline_Stream)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+// Same stream routed by symbol to N shards that parse and consume locally
+static void BM_Pipeline_Sharded(benchmark::State& state) {
+    std::string buffer = generate_message_stream(4 << 20);
+    PipelineOptions options;
+    options.parser_threads = static_cast<size_t>(state.range(0));
+    ParsePipeline pipeline(options);
+    std::vector<double> notional(options.parser_threads * 8);  // One cache line per shard
+    size_t messages = 0;
+
+    for (auto _ : state) {
+        size_t offset = 0;
+        auto source = [&](std::span<char> out) {
+            const size_t count = std::min({out.size(), buffer.size() - offset, size_t(64 * 1024)});
+            std::memcpy(out.data(), buffer.data() + offset, count);
+            offset += count;
+            return count;
+        };
+        auto stats = pipeline.run_sharded(source, [&](uint32_t shard, std::span<const ParsedRecord> records) {
+            for (const ParsedRecord& record : records) {
+                notional[shard * 8] += record.message.price() * record.message.quantity;
+            }
+        });
+        messages = stats.messages;
+    }
+    benchmark::DoNotOptimize(notional.data());
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Pipeline_Sharded)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+// Routing key only: find tag 55 and pick a shard, no parse
+static void BM_Scan_Symbol_Shard(benchmark::State& state) {
+    auto storage = generate_message_batch(1024);
+    std::vector<std::string_view> messages(storage.begin(), storage.end());
+
+    for (auto _ : state) {
+        uint32_t shards = 0;
+        for (std::string_view message : messages) {
+            shards += symbol_shard(scan_symbol(message), 8);
+        }
+        benchmark::DoNotOptimize(shards);
+    }
+
+    state.SetItemsProcessed(state.iterations() * messages.size());
+}
+BENCHMARK(BM_Scan_Symbol_Shard);
+
+// ============================================================================
+// FIELD BATCH BENCHMARKS
+// ============================================================================
+
+// SMALL_MESSAGE-sized orders (~45 bytes) with varying prices
+static std::vector<std::string> generate_small_orders(size_t count) {
+    std::vector<std::string> orders;
+    orders.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string order = "8=FIX.4.4|35=D|55=SPY|54=1|38=100|44=";
+        order += std::to_string(400 + i % 100);
+        order += '.';
+        order += std::to_string(10 + i % 90);
+        order += '|';
+        orders.push_back(std::move(order));
+    }
+    return orders;
+}
+
+// Price of every tiny message: one masked load per message, eight prices per vector
+static void BM_Extract_Price_Batch(benchmark::State& state) {
+    auto storage = generate_small_orders(1024);
+    std::vector<std::string_view> messages(storage.begin(), storage.end());
+    std::vector<double> prices(messages.size());
+    std::vector<Decimal64> decimals(messages.size());
+
+    for (auto _ : state) {
+        extract_price_batch(messages, prices, decimals);
+        benchmark::DoNotOptimize(prices.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * messages.size());
+}
+BENCHMARK(BM_Extract_Price_Batch);
+
+// Same prices through one field-masked parse per message
+static void BM_Extract_Price_Parse_Loop(benchmark::State& state) {
+    auto storage = generate_small_orders(1024);
+    std::vector<std::string_view> messages(storage.begin(), storage.end());
+    std::vector<double> prices(messages.size());
+    const FieldMask fields{FIXTag::Price};
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < messages.size(); ++i) {
+            prices[i] = parse_simd(messages[i], fields).price();
+        }
+        benchmark::DoNotOptimize(prices.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * messages.size());
+}
+BENCHMARK(BM_Extract_Price_Parse_Loop);
+
+// Locating tag 44 alone, per tier
+static void BM_Extract_Field_Batch(benchmark::State& state) {
+    const auto level = static_cast<SimdLevel>(state.range(0));
+    if (level > cpu_features().best_level()) {
+        state.SkipWithError("tier not supported by this CPU");
+        return;
+    }
+    auto storage = generate_small_orders(1024);
+    std::vector<std::string_view> messages(storage.begin(), storage.end());
+    std::vector<std::string_view> values(messages.size());
+
+    for (auto _ : state) {
+        extract_field_batch(messages, 44, values, level);
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetLabel(simd_level_name(level));
+    state.SetItemsProcessed(state.iterations() * messages.size());
+}
+BENCHMARK(BM_Extract_Field_Batch)
+    ->Arg(static_cast<int>(SimdLevel::Scalar))
+    ->Arg(static_cast<int>(SimdLevel::AVX2))
+    ->Arg(static_cast<int>(SimdLevel::AVX512));
+
+// ============================================================================
+// MARKET DATA BENCHMARKS
+// ============================================================================
+
+// Parse a 35=X refresh with N group entries into SoA columns
+static void BM_Parse_Market_Data(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::string msg = generate_market_data_refresh(count);
+    ParserContext context;
+    MarketDataEntries entries;
+
+    for (auto _ : state) {
+        auto result = parse_market_data(msg, context, entries);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(entries.prices.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * msg.size());
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Parse_Market_Data)->Arg(4)->Arg(16)->Arg(64);
+
 // ============================================================================
 // LATENCY PERCENTILE BENCHMARKS
 // ============================================================================
@@ -367,7 +1114,11 @@ int main(int argc, char** argv) {
 
     // Print CPU info
     std::cout << "CPU Features:\n";
+    std::cout << "  SSE4.2 Support:  " << (cpu_features().sse42 ? "YES" : "NO") << "\n";
+    std::cout << "  AVX2 Support:    " << (cpu_features().avx2 ? "YES" : "NO") << "\n";
     std::cout << "  AVX-512 Support: " << (has_avx512_support() ? "YES" : "NO") << "\n";
+    std::cout << "  VBMI2 Support:   " << (cpu_features().avx512vbmi2 ? "YES" : "NO") << "\n";
+    std::cout << "  Selected Tier:   " << simd_level_name(cpu_features().best_level()) << "\n";
     std::cout << "\n";
 
     // Print test message sizes
@@ -25,12 +25,24 @@ inline const std::string LARGE_MESSAGE =
     "8=FIX.4.4|35=D|49=QUANTITATIVE_HEDGE_FUND|56=PRIMARY_EXCHANGE_NETWORK|"
     "55=GOOGL|54=1|38=10000|44=141.75|";
 
-// Extra large message (~250 bytes) - stress test
+// Extra large buffer (~250 bytes) - two messages back to back, as read off a
+// stream; split it with frame_messages() before parsing
 inline const std::string XLARGE_MESSAGE =
     "8=FIX.4.4|35=D|49=INSTITUTIONAL_ASSET_MANAGER_ALPHA|"
     "56=CONSOLIDATED_EXCHANGE_ROUTING_NETWORK|55=BRK.A|54=1|38=5|44=628450.00|"
     "8=FIX.4.4|35=D|49=SECONDARY_TRADER|56=BACKUP_EXCHANGE|55=MSFT|54=2|38=500|44=378.50|";
 
+// Long execution report (~470 bytes): routing fields up front, then the
+// fill details, party IDs and free text a real venue appends
+inline const std::string EXECUTION_REPORT_MESSAGE =
+    "8=FIX.4.4|9=450|35=8|49=PRIMARY_EXCHANGE|56=QUANT_FUND_07|34=18234|"
+    "52=20240115-14:30:00.123|55=AAPL|37=EX-2024-0115-000123|11=CL-88812|"
+    "17=EXEC-5521-0001|150=F|39=1|54=1|38=10000|44=150.25|32=2500|31=150.24|"
+    "151=7500|14=2500|6=150.24|60=20240115-14:30:00.122|1=ACCOUNT-ALPHA-0042|"
+    "453=3|448=BROKER-XYZ|447=D|452=1|448=CLEARING-FIRM-ABC|447=D|452=4|"
+    "448=TRADER-JSMITH|447=D|452=11|30=XNAS|851=1|1057=Y|"
+    "58=PARTIAL FILL ON PRIMARY LISTING VENUE, REMAINDER RESTING AT LIMIT|";
+
 // Generate a batch of messages for throughput testing
 inline std::vector<std::string> generate_message_batch(size_t count) {
     std::vector<std::string> messages;
@@ -92,6 +104,83 @@ inline std::string generate_delimiter_string(size_t length, size_t delimiter_cou
     return result;
 }
 
+// Generate a stream buffer of back-to-back messages of roughly target_bytes
+inline std::string generate_message_stream(size_t target_bytes) {
+    std::string stream;
+    stream.reserve(target_bytes + 128);
+
+    size_t batch = 64;
+    while (stream.size() < target_bytes) {
+        for (const auto& msg : generate_message_batch(batch)) {
+            stream += msg;
+            if (stream.size() >= target_bytes) {
+                break;
+            }
+        }
+    }
+
+    return stream;
+}
+
+// Generate FIX-style price strings ("150.25", "0.0025", "628450.00", ...)
+inline std::vector<std::string> generate_price_strings(size_t count) {
+    const char* prices[] = {"150.25", "378.50", "141.75", "0.0025", "628450.00",
+                            "875.3", "1.5", "45.25", "12345.678", "99.99"};
+    std::vector<std::string> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        values.emplace_back(prices[i % 10]);
+    }
+    return values;
+}
+
+// Generate a stream of messages with real BodyLength (9) and CheckSum (10)
+// fields, of roughly target_bytes
+inline std::string generate_framed_message_stream(size_t target_bytes) {
+    const std::string begin_string = "8=FIX.4.4|";
+    std::string stream;
+    stream.reserve(target_bytes + 160);
+
+    while (stream.size() < target_bytes) {
+        for (const auto& msg : generate_message_batch(64)) {
+            std::string body = msg.substr(begin_string.size());
+            std::string framed = begin_string + "9=" + std::to_string(body.size()) + "|" + body;
+
+            unsigned checksum = 0;
+            for (char c : framed) {
+                checksum += static_cast<unsigned char>(c);
+            }
+            framed += "10=" + std::to_string(1000 + checksum % 256).substr(1) + "|";
+
+            stream += framed;
+            if (stream.size() >= target_bytes) {
+                break;
+            }
+        }
+    }
+
+    return stream;
+}
+
+// Generate a MarketDataIncrementalRefresh (35=X) with `entries` NoMDEntries
+// group entries, alternating bid/offer updates
+inline std::string generate_market_data_refresh(size_t entries) {
+    std::string body = "35=X|49=EXCHANGE|56=CLIENT|34=1|262=REQ|268=" + std::to_string(entries) + "|";
+    for (size_t i = 0; i < entries; ++i) {
+        body += "279=" + std::to_string(i % 3) + "|269=" + std::to_string(i % 2) +
+                "|55=AAPL|270=" + std::to_string(150 + i) + ".25|271=" +
+                std::to_string((i + 1) * 100) + "|";
+    }
+    std::string msg = "8=FIX.4.4|9=" + std::to_string(body.size()) + "|" + body;
+
+    unsigned checksum = 0;
+    for (char c : msg) {
+        checksum += static_cast<unsigned char>(c);
+    }
+    msg += "10=" + std::to_string(1000 + checksum % 256).substr(1) + "|";
+    return msg;
+}
+
 // Prevent compiler from optimizing away results
 template<typename T>
 inline void do_not_optimize(T&& value) {
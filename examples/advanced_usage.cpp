@@ -27,11 +27,14 @@ void print_separator(char c = '=', int width = 70) {
 
 // Helper function to format large numbers with commas
 std::string format_number(uint64_t n) {
-    std::string str = std::to_string(n);
-    int insert_pos = static_cast<int>(str.length()) - 3;
-    while (insert_pos > 0) {
-        str.insert(insert_pos, ",");
-        insert_pos -= 3;
+    const std::string digits = std::to_string(n);
+    std::string str;
+    str.reserve(digits.size() + digits.size() / 3);
+    for (size_t i = 0; i < digits.size(); ++i) {
+        if (i > 0 && (digits.size() - i) % 3 == 0) {
+            str += ',';
+        }
+        str += digits[i];
     }
     return str;
 }
@@ -248,7 +251,7 @@ void demo_batch_parsing() {
                   << std::setw(10) << result.symbol
                   << std::setw(8) << (result.side == 1 ? "Buy" : "Sell")
                   << std::setw(12) << result.quantity
-                  << "$" << std::setw(14) << std::fixed << std::setprecision(2) << result.price
+                  << "$" << std::setw(14) << std::fixed << std::setprecision(2) << result.price()
                   << std::setw(10) << (result.valid ? "Yes" : "No") << "\n";
     }
 
@@ -263,7 +266,7 @@ void demo_batch_parsing() {
     double total_value = 0.0;
     for (const auto& result : results) {
         total_quantity += result.quantity;
-        total_value += result.price * result.quantity;
+        total_value += result.price() * result.quantity;
     }
 
     std::cout << "\n  Total shares: " << format_number(total_quantity) << "\n";
@@ -346,7 +349,7 @@ void demo_file_parsing(const std::string& filename) {
                       << result.symbol << " "
                       << (result.side == 1 ? "BUY" : "SELL") << " "
                       << result.quantity << " @ $"
-                      << std::fixed << std::setprecision(2) << result.price << "\n";
+                      << std::fixed << std::setprecision(2) << result.price() << "\n";
         }
         count++;
     }
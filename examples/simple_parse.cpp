@@ -69,9 +69,9 @@ void print_message(const simd_parser::FIXMessage& msg, int msg_num) {
     if (msg.quantity != 0) {
         std::cout << "  " << std::setw(12) << "Quantity:" << msg.quantity << "\n";
     }
-    if (msg.price != 0.0) {
+    if (msg.price() != 0.0) {
         std::cout << "  " << std::setw(12) << "Price:" << std::fixed << std::setprecision(2)
-                  << "$" << msg.price << "\n";
+                  << "$" << msg.price() << "\n";
     }
 }
 
@@ -148,7 +148,7 @@ int main() {
         scalar_result.target == simd_result.target &&
         scalar_result.side == simd_result.side &&
         scalar_result.quantity == simd_result.quantity &&
-        scalar_result.price == simd_result.price &&
+        scalar_result.price() == simd_result.price() &&
         scalar_result.valid == simd_result.valid;
 
     std::cout << "Results match: " << (results_match ? "YES" : "NO") << "\n";
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace simd_parser {
+
+/**
+ * Exact decimal number: mantissa * 10^exponent.
+ *
+ * FIX prices are decimal strings ("150.25"); keeping them as a scaled
+ * integer avoids binary floating-point rounding and lets matching and risk
+ * code work in integer ticks. "150.25" parses to {15025, -2}; trailing
+ * zeros are kept, so "150.250" is {150250, -3} and compares equal.
+ */
+struct Decimal64 {
+    int64_t mantissa = 0;
+    int32_t exponent = 0;
+
+    /**
+     * Powers of ten that fit in int64_t (10^0 .. 10^18).
+     */
+    static constexpr int64_t pow10(int32_t n) {
+        int64_t result = 1;
+        for (int32_t i = 0; i < n; ++i) {
+            result *= 10;
+        }
+        return result;
+    }
+
+    /**
+     * Mantissa at another exponent, e.g. rescale(-4) for ticks of 0.0001.
+     * Extra digits are truncated toward zero; the caller must keep the
+     * result within int64_t.
+     *
+     * @param target_exponent Exponent of the result
+     * @return mantissa * 10^(exponent - target_exponent)
+     */
+    constexpr int64_t rescale(int32_t target_exponent) const {
+        return exponent >= target_exponent ? mantissa * pow10(exponent - target_exponent)
+                                           : mantissa / pow10(target_exponent - exponent);
+    }
+
+    /**
+     * @return true if to_double() is correctly rounded: the mantissa is below
+     *         2^53 and 10^|exponent| is at most 10^22, so both are exact
+     *         doubles and one IEEE multiply or divide combines them
+     */
+    constexpr bool converts_exactly() const {
+        const uint64_t magnitude = mantissa < 0 ? 0 - static_cast<uint64_t>(mantissa)
+                                                : static_cast<uint64_t>(mantissa);
+        return magnitude < (uint64_t{1} << 53) && exponent >= -22 && exponent <= 22;
+    }
+
+    /**
+     * Nearest double. Exact division by a power of ten, so the result is
+     * correctly rounded whenever converts_exactly() holds.
+     */
+    double to_double() const {
+        static constexpr double POW10[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+        };
+        const double value = static_cast<double>(mantissa);
+        if (exponent <= 0 && exponent >= -22) {
+            return value / POW10[-exponent];
+        }
+        if (exponent > 0 && exponent <= 22) {
+            return value * POW10[exponent];
+        }
+        return value * std::pow(10.0, exponent);
+    }
+
+    friend constexpr bool operator==(const Decimal64& a, const Decimal64& b) {
+        const int32_t common = a.exponent < b.exponent ? a.exponent : b.exponent;
+        return a.rescale(common) == b.rescale(common);
+    }
+};
+
+} // namespace simd_parser
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include "framer.hpp"
+#include "parser.hpp"
+#include "simd_utils.hpp"
+#include <string_view>
+
+namespace simd_parser {
+
+/**
+ * Parses a message into a struct generated by fix_codegen from a data
+ * dictionary (see spec/FIX44.xml and the generated fix44_messages.hpp).
+ *
+ * A generated Message provides:
+ * - MSG_TYPE: the MsgType (35) value it accepts
+ * - SLOTS: constexpr tag → slot + 1 table (0 for tags it does not carry)
+ * - set(slot, value): a switch over its own fields only, converting each
+ *   value to its dictionary type
+ * - has_required(): the required-field bitmask check
+ *
+ * Because everything is a compile-time constant of Message, each
+ * instantiation dispatches over exactly that message's fields.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @param context Scratch buffers reused across calls
+ * @param out Output message; reset first
+ * @return true if the MsgType matches, the message is not shorter than its
+ *         BodyLength and every required field is present
+ */
+template <typename Message, char Delimiter = '|'>
+bool parse_message(std::string_view message, ParserContext& context, Message& out) {
+    out = Message{};
+
+    BodyLocation location;
+    if (message.empty() || (locate_body<Delimiter>(message, location) == FrameStatus::Complete &&
+                            message.size() < location.body_end())) {
+        return false;
+    }
+
+    build_structural_index<Delimiter>(message, context.index);
+
+    bool type_matches = false;
+    for_each_field(message, context.index, [&](std::string_view tag_str, std::string_view value) {
+        const uint32_t tag = parse_tag(tag_str);
+        if (tag == static_cast<uint32_t>(FIXTag::MessageType)) {
+            type_matches = value == Message::MSG_TYPE;
+        } else if (tag < Message::SLOTS.size() && Message::SLOTS[tag] != 0) {
+            out.set(Message::SLOTS[tag] - 1, value);
+        }
+    });
+
+    return type_matches && out.has_required();
+}
+
+} // namespace simd_parser
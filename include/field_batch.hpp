@@ -0,0 +1,71 @@
+#pragma once
+
+#include "decimal.hpp"
+#include "fix_message.hpp"
+#include "simd_utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace simd_parser {
+
+/**
+ * Finds the value of one tag in every message of a batch, without parsing
+ * the messages: values[i] is the value of `tag` in messages[i].
+ *
+ * Built for streams of short messages (e.g. ~45-byte NewOrderSingles), where
+ * a field walk spends most of its time on per-message setup and scalar
+ * tails. With AVX-512 a message of up to 64 bytes is one masked load, and
+ * "<delim>tag=" is found by comparing that register against each pattern
+ * byte and ANDing the shifted compare masks; the value ends at the next bit
+ * of the delimiter mask already computed. Every message thus costs the same
+ * few vector instructions, with no data-dependent loop, and consecutive
+ * messages are independent, so the CPU overlaps them. Longer messages are
+ * covered by overlapping 64-byte steps.
+ *
+ * @param messages FIX messages (fields separated by Delimiter)
+ * @param tag Tag to extract
+ * @param values Results; must hold at least messages.size() elements. A
+ *               message without the tag yields an empty view.
+ */
+template <char Delimiter = '|'>
+void extract_field_batch(std::span<const std::string_view> messages, uint32_t tag,
+                         std::span<std::string_view> values);
+
+/**
+ * extract_field_batch() on a specific tier, for testing and benchmarking.
+ * The tier must be supported by the CPU (see cpu_features()).
+ */
+template <char Delimiter = '|'>
+void extract_field_batch(std::span<const std::string_view> messages, uint32_t tag,
+                         std::span<std::string_view> values, SimdLevel level);
+
+/**
+ * Price (44) of every message of a batch. Values are located with
+ * extract_field_batch() and converted with parse_price_batch(), so with
+ * AVX-512 eight messages' prices are combined per vector.
+ *
+ * @param messages FIX messages (fields separated by Delimiter)
+ * @param prices Results as double; must hold at least messages.size() elements
+ * @param decimals Exact results; must hold at least messages.size() elements.
+ *                 A message without a price yields 0.
+ */
+template <char Delimiter = '|'>
+void extract_price_batch(std::span<const std::string_view> messages, std::span<double> prices,
+                         std::span<Decimal64> decimals);
+
+extern template void extract_field_batch<'|'>(std::span<const std::string_view>, uint32_t,
+                                              std::span<std::string_view>);
+extern template void extract_field_batch<SOH>(std::span<const std::string_view>, uint32_t,
+                                              std::span<std::string_view>);
+extern template void extract_field_batch<'|'>(std::span<const std::string_view>, uint32_t,
+                                              std::span<std::string_view>, SimdLevel);
+extern template void extract_field_batch<SOH>(std::span<const std::string_view>, uint32_t,
+                                              std::span<std::string_view>, SimdLevel);
+extern template void extract_price_batch<'|'>(std::span<const std::string_view>, std::span<double>,
+                                              std::span<Decimal64>);
+extern template void extract_price_batch<SOH>(std::span<const std::string_view>, std::span<double>,
+                                              std::span<Decimal64>);
+
+} // namespace simd_parser
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace simd_parser {
+
+/**
+ * Location of every field of one message, for lookups of tags that
+ * FIXMessage does not store (ClOrdID, OrderID, ExecType, TransactTime, ...).
+ *
+ * Fields are kept in wire order as offset/length pairs into the message.
+ * Tags below TAG_TABLE_SIZE also get a direct-indexed entry pointing at
+ * their first occurrence, so looking them up is a single table read; larger
+ * (user-defined) tags go into a small open-addressed hash table instead, so
+ * they are found in constant time as well.
+ *
+ * Like FIXMessage, values are views into the parsed buffer: the buffer must
+ * outlive any lookups. Reuse one index across messages; after the first few
+ * messages it no longer allocates.
+ */
+class FieldIndex {
+public:
+    static constexpr size_t DEFAULT_MAX_FIELDS = 256;
+
+    struct Field {
+        uint32_t tag;
+        uint32_t value_offset;  // Offset of the value within the message
+        uint32_t value_length;
+    };
+
+    /**
+     * @param max_fields Field count to reserve space for up front
+     */
+    explicit FieldIndex(size_t max_fields = DEFAULT_MAX_FIELDS);
+
+    /**
+     * Forgets the previous message and starts indexing a new one. Only the
+     * table slots the previous message set are cleared, so the cost is
+     * proportional to its field count rather than the table sizes.
+     *
+     * @param message Buffer whose fields will be added
+     */
+    void reset(std::string_view message);
+
+    /**
+     * Records a field of the current message.
+     *
+     * @param tag Tag number (0 for tags that are not numeric; never found)
+     * @param value Value view; must point into the current message
+     */
+    void add(uint32_t tag, std::string_view value) {
+        const uint32_t position = static_cast<uint32_t>(fields_.size());
+        fields_.push_back({tag, static_cast<uint32_t>(value.data() - message_.data()),
+                           static_cast<uint32_t>(value.size())});
+        // Tag 0 stands for a non-numeric tag and stays out of the lookup table
+        if (tag < TAG_TABLE_SIZE) {
+            if (tag != 0 && first_[tag] == 0) {
+                first_[tag] = position + 1;
+            }
+        } else {
+            add_large_tag(tag, position);
+        }
+    }
+
+    /**
+     * Looks up the value of the first occurrence of a tag.
+     *
+     * @param tag Tag number
+     * @return Value view, or an empty view with a null data() if absent
+     */
+    std::string_view get(uint32_t tag) const {
+        if (tag < TAG_TABLE_SIZE) {
+            const uint32_t entry = first_[tag];
+            return entry == 0 ? std::string_view() : value(fields_[entry - 1]);
+        }
+        return find_large_tag(tag);
+    }
+
+    /**
+     * @param tag Tag number
+     * @return true if the message contains the tag
+     */
+    bool contains(uint32_t tag) const {
+        return get(tag).data() != nullptr;
+    }
+
+    /**
+     * @param field Entry of fields()
+     * @return The field's value
+     */
+    std::string_view value(const Field& field) const {
+        return message_.substr(field.value_offset, field.value_length);
+    }
+
+    /**
+     * @return Every field of the message in wire order, repeats included
+     */
+    const std::vector<Field>& fields() const { return fields_; }
+
+    size_t size() const { return fields_.size(); }
+    std::string_view message() const { return message_; }
+
+private:
+    // Slot count the large-tag table starts with; always a power of two
+    static constexpr size_t MIN_LARGE_TAG_SLOTS = 64;
+
+    struct LargeTagSlot {
+        uint32_t tag = 0;
+        uint32_t entry = 0;  // 1 + position in fields_, 0 if the slot is free
+    };
+
+    void add_large_tag(uint32_t tag, uint32_t position);
+    void grow_large_tags();
+    std::string_view find_large_tag(uint32_t tag) const;
+
+    /**
+     * Home slot of a large tag: Fibonacci hashing, so tags that share their
+     * low bits (20001, 21001, ...) still spread over the table.
+     */
+    size_t large_tag_home(uint32_t tag) const {
+        return (static_cast<uint64_t>(tag) * 0x9E3779B97F4A7C15ull) >> large_tag_shift_;
+    }
+
+    std::string_view message_;
+    std::vector<Field> fields_;
+    std::array<uint32_t, TAG_TABLE_SIZE> first_{};  // 1 + position in fields_, 0 if absent
+
+    // Tags >= TAG_TABLE_SIZE, linear probing; kept at most half full
+    std::vector<LargeTagSlot> large_tags_;
+    std::vector<uint32_t> large_used_;  // Slots the current message filled
+    unsigned large_tag_shift_ = 0;      // 64 - log2(large_tags_.size())
+};
+
+} // namespace simd_parser
@@ -1,10 +1,27 @@
 #pragma once
 
+#include "decimal.hpp"
+#include "swar.hpp"
+#include <array>
+#include <initializer_list>
 #include <string_view>
+#include <type_traits>
 #include <cstdint>
 
 namespace simd_parser {
 
+/**
+ * Field delimiter used by FIX on the wire (ASCII 0x01, "Start of Header").
+ * Human-readable logs usually substitute '|'.
+ */
+constexpr char SOH = '\x01';
+
+/**
+ * FIXMessage::symbol_id of a message that was parsed without a SymbolTable
+ * or has no Symbol.
+ */
+constexpr uint32_t NO_SYMBOL_ID = UINT32_MAX;
+
 /**
  * Represents a parsed FIX protocol message.
  * Uses string_view for zero-copy parsing - views point into original message buffer.
@@ -12,17 +29,34 @@ namespace simd_parser {
 struct FIXMessage {
     std::string_view message_type;  // Tag 35: Message type (D=NewOrderSingle, 8=ExecutionReport, etc.)
     std::string_view symbol;        // Tag 55: Symbol/ticker
+    uint32_t symbol_id;             // Tag 55: Dense id from ParserContext::symbols (NO_SYMBOL_ID if none)
     std::string_view sender;        // Tag 49: Sender ID
     std::string_view target;        // Tag 56: Target ID
     int32_t side;                   // Tag 54: Side (1=Buy, 2=Sell)
-    double price;                   // Tag 44: Price
+    Decimal64 price_decimal;        // Tag 44: Price, exact (zero if not a plain decimal)
+    double price_fallback;          // Tag 44: Price, only where price_decimal cannot give it exactly (else 0)
     int32_t quantity;               // Tag 38: Order quantity
+    int32_t body_length;            // Tag 9: Declared body length in bytes
+    int64_t sending_time;           // Tag 52: ns since the Unix epoch (0 if absent or malformed)
+    int64_t transact_time;          // Tag 60: ns since the Unix epoch (0 if absent or malformed)
 
     // Indicates if parsing was successful
     bool valid;
 
+    // Tag 10 was present and matches the byte sum of the message before it
+    bool checksum_valid;
+
     FIXMessage()
-        : side(0), price(0.0), quantity(0), valid(false) {}
+        : symbol_id(NO_SYMBOL_ID), side(0), price_fallback(0.0), quantity(0), body_length(0), sending_time(0),
+          transact_time(0), valid(false), checksum_valid(false) {}
+
+    /**
+     * Tag 44 as a double, converted from price_decimal on demand; parsing
+     * only fills price_fallback for prices the decimal cannot reproduce.
+     */
+    double price() const {
+        return price_fallback != 0.0 ? price_fallback : price_decimal.to_double();
+    }
 };
 
 /**
@@ -38,6 +72,152 @@ enum class FIXTag : uint32_t {
     Symbol = 55,         // Trading symbol
     OrderQty = 38,       // Order quantity
     Price = 44,          // Price per unit
+    SendingTime = 52,    // UTCTimestamp the message was sent
+    TransactTime = 60,   // UTCTimestamp of the business event
+    CheckSum = 10,       // Byte sum mod 256 of everything before this field
+};
+
+/**
+ * Destination of a parsed tag. Slots are dense, so dispatch indexes a table
+ * instead of branching over sparse tag numbers.
+ */
+enum class FieldSlot : uint8_t {
+    None = 0,      // Tag is not stored
+    MessageType,
+    Symbol,
+    Sender,
+    Target,
+    Side,
+    Price,
+    OrderQty,
+    BodyLength,
+    SendingTime,
+    TransactTime,
+    CheckSum,
+};
+
+constexpr size_t FIELD_SLOT_COUNT = static_cast<size_t>(FieldSlot::CheckSum) + 1;
+
+/**
+ * Tags below this bound are looked up directly; every tag the parser stores
+ * is far below it.
+ */
+constexpr uint32_t TAG_TABLE_SIZE = 1024;
+
+namespace detail {
+
+constexpr std::array<FieldSlot, TAG_TABLE_SIZE> make_tag_slots() {
+    std::array<FieldSlot, TAG_TABLE_SIZE> slots{};
+    slots[static_cast<uint32_t>(FIXTag::MessageType)] = FieldSlot::MessageType;
+    slots[static_cast<uint32_t>(FIXTag::Symbol)] = FieldSlot::Symbol;
+    slots[static_cast<uint32_t>(FIXTag::SenderCompID)] = FieldSlot::Sender;
+    slots[static_cast<uint32_t>(FIXTag::TargetCompID)] = FieldSlot::Target;
+    slots[static_cast<uint32_t>(FIXTag::Side)] = FieldSlot::Side;
+    slots[static_cast<uint32_t>(FIXTag::Price)] = FieldSlot::Price;
+    slots[static_cast<uint32_t>(FIXTag::OrderQty)] = FieldSlot::OrderQty;
+    slots[static_cast<uint32_t>(FIXTag::BodyLength)] = FieldSlot::BodyLength;
+    slots[static_cast<uint32_t>(FIXTag::SendingTime)] = FieldSlot::SendingTime;
+    slots[static_cast<uint32_t>(FIXTag::TransactTime)] = FieldSlot::TransactTime;
+    slots[static_cast<uint32_t>(FIXTag::CheckSum)] = FieldSlot::CheckSum;
+    return slots;
+}
+
+} // namespace detail
+
+/**
+ * Tag number -> slot, built at compile time.
+ */
+inline constexpr std::array<FieldSlot, TAG_TABLE_SIZE> TAG_SLOTS = detail::make_tag_slots();
+
+/**
+ * Looks up the slot for a tag number.
+ *
+ * @param tag Tag number
+ * @return Slot, or None for tags that are not stored
+ */
+constexpr FieldSlot field_slot(uint32_t tag) {
+    return tag < TAG_TABLE_SIZE ? TAG_SLOTS[tag] : FieldSlot::None;
+}
+
+/**
+ * Set of FIXMessage fields a caller wants, for parse_simd() with early exit:
+ *
+ *   parse_simd(message, FieldMask{FIXTag::MessageType, FIXTag::Symbol});
+ *
+ * Tags without a FieldSlot (e.g. BeginString) are ignored.
+ */
+class FieldMask {
+public:
+    constexpr FieldMask(std::initializer_list<FIXTag> tags) {
+        for (FIXTag tag : tags) {
+            const FieldSlot slot = field_slot(static_cast<uint32_t>(tag));
+            if (slot != FieldSlot::None) {
+                bits_ |= bit(slot);
+            }
+        }
+    }
+
+    constexpr bool contains(FieldSlot slot) const { return (bits_ & bit(slot)) != 0; }
+    constexpr bool empty() const { return bits_ == 0; }
+    constexpr uint32_t bits() const { return bits_; }
+
+    static constexpr uint32_t bit(FieldSlot slot) {
+        return uint32_t{1} << static_cast<uint32_t>(slot);
+    }
+
+private:
+    uint32_t bits_ = 0;
 };
 
+/**
+ * Longest tag accepted by parse_tag(); nine digits always fit in uint32_t.
+ */
+constexpr size_t MAX_TAG_DIGITS = 9;
+
+/**
+ * Longest tag parse_tag() folds digit by digit. Below this, a multiply-add
+ * per digit beats assembling a SWAR word; user-defined tags (5000+, 20000+)
+ * take the SWAR kernel.
+ */
+constexpr size_t MAX_FOLDED_TAG_DIGITS = 4;
+
+/**
+ * Converts tag digits ("35" in "35=D") to a tag number. Tags are short and
+ * unsigned, so the digits are converted inline instead of going through
+ * from_chars.
+ *
+ * @param tag Tag digits
+ * @return Tag number, or 0 (never a valid tag) if tag is empty, too long or
+ *         not all digits
+ */
+constexpr uint32_t parse_tag(std::string_view tag) {
+    if (tag.empty() || tag.size() > MAX_TAG_DIGITS) {
+        return 0;
+    }
+    if (tag.size() > MAX_FOLDED_TAG_DIGITS && !std::is_constant_evaluated()) {
+        uint64_t value = 0;
+        return swar::accumulate_digits(tag, 0, tag.size(), value) ? static_cast<uint32_t>(value) : 0;
+    }
+    uint32_t number = 0;
+    for (char c : tag) {
+        const uint32_t digit = static_cast<uint32_t>(static_cast<unsigned char>(c)) - '0';
+        if (digit > 9) {
+            return 0;
+        }
+        number = number * 10 + digit;
+    }
+    return number;
+}
+
+/**
+ * Looks up the slot for the tag digits of a field ("35" in "35=D").
+ * Anything longer than four digits is beyond the table and skipped early.
+ *
+ * @param tag Tag digits
+ * @return Slot, or None for unknown tags and tags that are not all digits
+ */
+constexpr FieldSlot field_slot(std::string_view tag) {
+    return tag.size() > 4 ? FieldSlot::None : field_slot(parse_tag(tag));
+}
+
 } // namespace simd_parser
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace simd_parser {
+
+/**
+ * Result of framing one buffer of a FIX byte stream.
+ */
+struct FrameResult {
+    size_t message_count = 0;  // Messages written to the output span
+    size_t consumed = 0;       // Bytes the caller may drop from the front of the buffer
+    size_t bytes_needed = 0;   // Full size of the held-back message, if its header
+                               // declared it (length-driven framing only)
+};
+
+/**
+ * Outcome of inspecting the start of a buffer for one message.
+ */
+enum class FrameStatus : uint8_t {
+    Complete,    // Everything asked for is present
+    Incomplete,  // A prefix of a valid message; wait for more bytes
+    Malformed,   // Not a message start, or the header/trailer is inconsistent
+};
+
+/**
+ * Position of a message body as declared by its BodyLength (tag 9).
+ *
+ * FIX defines BodyLength as the byte count from just after the delimiter
+ * ending "9=N" up to and including the delimiter before "10=".
+ */
+struct BodyLocation {
+    size_t body_start = 0;   // First byte after "8=...<delim>9=N<delim>"
+    size_t body_length = 0;  // Declared BodyLength
+
+    size_t body_end() const { return body_start + body_length; }
+};
+
+/**
+ * Size of the CheckSum trailer: "10=" + three digits + delimiter.
+ */
+constexpr size_t CHECKSUM_FIELD_SIZE = 7;
+
+/**
+ * Reads the standard header ("8=<BeginString><delim>9=<BodyLength><delim>")
+ * at the start of buffer. Only the first two fields are touched.
+ *
+ * @param buffer Bytes starting at a message
+ * @param location Output; set when the header is complete
+ * @return Complete, Incomplete if buffer ends inside the header, or
+ *         Malformed if buffer does not start with "8=" followed by "9=<digits>"
+ */
+template <char Delimiter = '|'>
+FrameStatus locate_body(std::string_view buffer, BodyLocation& location);
+
+/**
+ * Computes the full length of the message at the start of buffer from its
+ * BodyLength, without scanning the body: the header gives the body end, and
+ * a "10=xxx" trailer must start right there.
+ *
+ * @param buffer Bytes starting at a message
+ * @param length Output; the message length when Complete, the number of
+ *               bytes to wait for when Incomplete (0 if the header itself is
+ *               not complete yet)
+ * @return Complete, Incomplete or Malformed (including a BodyLength that does
+ *         not land on a trailer)
+ */
+template <char Delimiter = '|'>
+FrameStatus message_extent(std::string_view buffer, size_t& length);
+
+/**
+ * Splits a buffer of back-to-back messages using each message's BodyLength.
+ *
+ * Unlike frame_messages(), only the headers and trailers are read; message
+ * bodies are skipped. When the last message is incomplete, bytes_needed
+ * reports its full size once its header has arrived, so a stream reader can
+ * wait for exactly that many bytes instead of re-framing every recv.
+ * Malformed input is skipped up to the next "<delim>8=FIX". A BodyLength
+ * that overshoots looks Incomplete until enough bytes arrive to show the
+ * missing trailer.
+ *
+ * @param buffer Stream bytes (fields separated by Delimiter)
+ * @param out Output span for message views; framing stops when it is full
+ * @return Messages written, bytes consumed and, if known, bytes needed
+ */
+template <char Delimiter = '|'>
+FrameResult frame_messages_by_length(std::string_view buffer, std::span<std::string_view> out);
+
+/**
+ * Splits a buffer of back-to-back FIX messages (e.g. a TCP recv buffer) into
+ * individual messages.
+ *
+ * One SIMD pass classifies the buffer into delimiter, '8', '1' and '='
+ * bitmasks. Combining them yields every "<delim>8=" and "<delim>1?=" position,
+ * which are checked for "8=FIX" (message start) and "10=" (CheckSum trailer):
+ *
+ * - A message starts at "8=FIX" at the start of the buffer or right after a
+ *   delimiter.
+ * - It ends after the delimiter terminating its "10=xxx" trailer or, for
+ *   messages without a trailer, right before the next message start.
+ * - Stray bytes between messages are skipped, provided they end in a
+ *   delimiter so the next BeginString is recognised.
+ *
+ * The last message is held back unless its trailer has been seen or
+ * end_of_stream is set, since more of it may still be in flight. Keep the
+ * bytes from `consumed` onwards and prepend them to the next read.
+ *
+ * Messages are returned as views into buffer; no bytes are copied.
+ *
+ * @param buffer Stream bytes (fields separated by Delimiter)
+ * @param out Output span for message views; framing stops when it is full
+ * @param end_of_stream Treat the end of buffer as the end of the last message
+ * @return Number of messages written and number of bytes consumed
+ */
+template <char Delimiter = '|'>
+FrameResult frame_messages(std::string_view buffer, std::span<std::string_view> out,
+                           bool end_of_stream = false);
+
+extern template FrameResult frame_messages<'|'>(std::string_view, std::span<std::string_view>, bool);
+extern template FrameResult frame_messages<SOH>(std::string_view, std::span<std::string_view>, bool);
+extern template FrameStatus locate_body<'|'>(std::string_view, BodyLocation&);
+extern template FrameStatus locate_body<SOH>(std::string_view, BodyLocation&);
+extern template FrameStatus message_extent<'|'>(std::string_view, size_t&);
+extern template FrameStatus message_extent<SOH>(std::string_view, size_t&);
+extern template FrameResult frame_messages_by_length<'|'>(std::string_view, std::span<std::string_view>);
+extern template FrameResult frame_messages_by_length<SOH>(std::string_view, std::span<std::string_view>);
+
+} // namespace simd_parser
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include "simd_utils.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace simd_parser {
+
+/**
+ * A parsed message that only records where each field's value is; numeric
+ * fields are converted the first time they are read and cached after that.
+ *
+ * Produced by parse_lazy(). A consumer that only routes on MsgType and
+ * TargetCompID never runs parse_int/parse_double.
+ *
+ * String fields are views into the parsed buffer, which must outlive the
+ * message. The cache makes the numeric accessors mutate state, so a message
+ * must not be read from two threads at once.
+ */
+class LazyFIXMessage {
+public:
+    LazyFIXMessage() = default;
+
+    /**
+     * @param message Buffer the fields will be recorded from
+     */
+    explicit LazyFIXMessage(std::string_view message) : message_(message) {}
+
+    std::string_view message_type() const { return field(FieldSlot::MessageType); }
+    std::string_view symbol() const { return field(FieldSlot::Symbol); }
+    std::string_view sender() const { return field(FieldSlot::Sender); }
+    std::string_view target() const { return field(FieldSlot::Target); }
+
+    int32_t side() const { return decode_int(FieldSlot::Side, side_); }
+    double price() const;
+    Decimal64 price_decimal() const;
+    int32_t quantity() const { return decode_int(FieldSlot::OrderQty, quantity_); }
+    int32_t body_length() const { return decode_int(FieldSlot::BodyLength, body_length_); }
+    int64_t sending_time() const { return decode_timestamp(FieldSlot::SendingTime, sending_time_); }
+    int64_t transact_time() const { return decode_timestamp(FieldSlot::TransactTime, transact_time_); }
+
+    bool valid() const { return !message_type().empty() && !symbol().empty(); }
+    bool checksum_valid() const { return checksum_valid_; }
+
+    /**
+     * @param slot Field to look up
+     * @return Unconverted value, empty if the field was absent
+     */
+    std::string_view value(FieldSlot slot) const { return field(slot); }
+
+    /**
+     * @param slot Field to look up
+     * @return true if the field has been converted and cached
+     */
+    bool is_decoded(FieldSlot slot) const { return (decoded_ & slot_bit(slot)) != 0; }
+
+    /**
+     * Converts every field, for consumers that want the eager struct after all.
+     *
+     * @return Same contents parse_simd() would have produced
+     */
+    FIXMessage to_message() const;
+
+    /**
+     * Records where a field's value is; a later field with the same slot
+     * replaces it, as in FIXMessage. Used by parse_lazy().
+     *
+     * @param slot Field slot
+     * @param value Value view; must point into the message
+     */
+    void record(FieldSlot slot, std::string_view value) {
+        fields_[static_cast<size_t>(slot)] = {
+            static_cast<uint32_t>(value.data() - message_.data()),
+            static_cast<uint32_t>(value.size())};
+    }
+
+    void set_checksum_valid(bool checksum_valid) { checksum_valid_ = checksum_valid; }
+
+private:
+    struct FieldRef {
+        uint32_t offset = 0;
+        uint32_t length = 0;
+    };
+
+    static constexpr uint32_t slot_bit(FieldSlot slot) {
+        return uint32_t{1} << static_cast<uint32_t>(slot);
+    }
+
+    std::string_view field(FieldSlot slot) const {
+        const FieldRef& ref = fields_[static_cast<size_t>(slot)];
+        return message_.substr(ref.offset, ref.length);
+    }
+
+    int32_t decode_int(FieldSlot slot, int32_t& cache) const {
+        if (!is_decoded(slot)) {
+            cache = parse_int(field(slot));
+            decoded_ |= slot_bit(slot);
+        }
+        return cache;
+    }
+
+    int64_t decode_timestamp(FieldSlot slot, int64_t& cache) const {
+        if (!is_decoded(slot)) {
+            cache = parse_timestamp(field(slot));
+            decoded_ |= slot_bit(slot);
+        }
+        return cache;
+    }
+
+    std::string_view message_;
+    std::array<FieldRef, FIELD_SLOT_COUNT> fields_{};
+    bool checksum_valid_ = false;
+
+    // Conversion cache; empty fields convert to 0 like in FIXMessage
+    mutable uint32_t decoded_ = 0;
+    mutable int32_t side_ = 0;
+    mutable double price_ = 0.0;
+    mutable Decimal64 price_decimal_;
+    mutable int32_t quantity_ = 0;
+    mutable int32_t body_length_ = 0;
+    mutable int64_t sending_time_ = 0;
+    mutable int64_t transact_time_ = 0;
+};
+
+} // namespace simd_parser
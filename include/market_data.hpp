@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace simd_parser {
+
+/**
+ * Tags of a MarketDataIncrementalRefresh (35=X) NoMDEntries group.
+ */
+enum class MDTag : uint32_t {
+    NoMDEntries = 268,     // Number of group entries that follow
+    MDEntryType = 269,     // '0'=Bid, '1'=Offer, '2'=Trade, ...
+    MDEntryPx = 270,       // Price
+    MDEntrySize = 271,     // Quantity
+    MDUpdateAction = 279,  // 0=New, 1=Change, 2=Delete
+};
+
+/**
+ * MDUpdateAction (tag 279) values.
+ */
+enum class MDUpdateAction : uint8_t {
+    New = 0,
+    Change = 1,
+    Delete = 2,
+};
+
+/**
+ * Entries of a NoMDEntries (268) group as struct-of-arrays columns, so a
+ * book builder can apply a whole update with vector loads: entry i is
+ * (actions[i], entry_types[i], prices[i], sizes[i], symbols[i]).
+ *
+ * After parsing, every column is zero-padded to a multiple of COLUMN_PADDING
+ * entries (one 512-bit vector of doubles), so full-width loops need no
+ * scalar tail; size() is the real entry count. Fields an entry omits keep
+ * their zero/empty default.
+ *
+ * Symbols are views into the parsed buffer, which must outlive them. Reuse
+ * one instance across messages; columns only grow.
+ */
+struct MarketDataEntries {
+    static constexpr size_t COLUMN_PADDING = 8;
+    static constexpr size_t DEFAULT_MAX_ENTRIES = 64;
+
+    std::vector<uint8_t> actions;            // Tag 279, as MDUpdateAction
+    std::vector<char> entry_types;           // Tag 269
+    std::vector<double> prices;              // Tag 270
+    std::vector<double> sizes;               // Tag 271
+    std::vector<std::string_view> symbols;   // Tag 55 (per entry in 35=X)
+
+    int32_t declared_count = 0;              // Tag 268 as sent
+
+    /**
+     * @param max_entries Entry count to reserve space for up front
+     */
+    explicit MarketDataEntries(size_t max_entries = DEFAULT_MAX_ENTRIES);
+
+    /**
+     * Empties all columns, keeping their capacity.
+     */
+    void clear();
+
+    /**
+     * Appends an entry with default values; the parser then overwrites the
+     * last row with the fields that are present.
+     */
+    void add_entry();
+
+    /**
+     * Pads every column to padded_size() with zeros.
+     */
+    void pad();
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /**
+     * @return size() rounded up to a multiple of COLUMN_PADDING
+     */
+    size_t padded_size() const {
+        return (count_ + COLUMN_PADDING - 1) / COLUMN_PADDING * COLUMN_PADDING;
+    }
+
+    MDUpdateAction action(size_t i) const { return static_cast<MDUpdateAction>(actions[i]); }
+
+private:
+    size_t count_ = 0;
+};
+
+} // namespace simd_parser
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace simd_parser {
+
+/**
+ * MessageBatch::msg_types value for a MsgType longer than two bytes; read
+ * the type from message(i) instead.
+ */
+constexpr uint16_t LONG_MSG_TYPE = 0xFFFF;
+
+/**
+ * Packs a MsgType (tag 35) into a 16-bit code, first byte low: "D" is 0x0044,
+ * "AE" is 0x4541. Standard types are one or two bytes, so a column of codes
+ * can be filtered with 16-bit vector compares.
+ *
+ * @param type MsgType value
+ * @return Packed code, 0 for an empty type, LONG_MSG_TYPE if longer than 2 bytes
+ */
+constexpr uint16_t pack_msg_type(std::string_view type) {
+    if (type.size() > 2) {
+        return LONG_MSG_TYPE;
+    }
+    uint16_t code = 0;
+    for (size_t i = type.size(); i-- > 0;) {
+        code = static_cast<uint16_t>((code << 8) | static_cast<uint8_t>(type[i]));
+    }
+    return code;
+}
+
+/**
+ * Messages of one receive buffer as struct-of-arrays columns, filled by
+ * parse_batch(): message i is (msg_types[i], symbol(i), sides[i], prices[i],
+ * quantities[i], ...). Analytics that scan one field touch only that column,
+ * instead of striding over whole FIXMessage structs.
+ *
+ * Strings are stored as offsets into `buffer`, which must outlive the batch
+ * and be smaller than 4 GiB. Fields a message omits keep their zero/empty
+ * default; symbol_ids stays NO_SYMBOL_ID unless the parse had a SymbolTable.
+ *
+ * After parsing, every column is zero-padded to a multiple of COLUMN_PADDING
+ * entries (one 512-bit vector of doubles), so full-width loops need no
+ * scalar tail; size() is the real message count. Reuse one batch across
+ * buffers; columns only grow.
+ */
+struct MessageBatch {
+    static constexpr size_t COLUMN_PADDING = 8;
+    static constexpr size_t DEFAULT_MAX_MESSAGES = 1024;
+
+    std::string_view buffer;               // Buffer the offsets point into
+
+    std::vector<uint32_t> offsets;         // Start of each message in buffer
+    std::vector<uint32_t> lengths;         // Message length in bytes
+    std::vector<uint16_t> msg_types;       // Tag 35, see pack_msg_type()
+    std::vector<uint32_t> symbol_offsets;  // Tag 55 value, offset in buffer
+    std::vector<uint16_t> symbol_lengths;  // Tag 55 value length (0 if absent)
+    std::vector<uint32_t> symbol_ids;      // Tag 55 interned by ParserContext::symbols
+    std::vector<int32_t> sides;            // Tag 54
+    std::vector<double> prices;            // Tag 44
+    std::vector<int32_t> quantities;       // Tag 38
+    std::vector<uint8_t> valid;            // MsgType and Symbol present
+    std::vector<uint8_t> checksum_valid;   // Tag 10 matches the message bytes
+
+    /**
+     * @param max_messages Message count to reserve space for up front
+     */
+    explicit MessageBatch(size_t max_messages = DEFAULT_MAX_MESSAGES);
+
+    /**
+     * Empties all columns, keeping their capacity, and sets the buffer the
+     * next messages will point into.
+     *
+     * @param source Buffer being parsed
+     */
+    void reset(std::string_view source);
+
+    /**
+     * Appends `count` rows with default values for the parser to fill in.
+     *
+     * @return Index of the first new row
+     */
+    size_t append(size_t count);
+
+    /**
+     * Pads every column to padded_size() with zeros (NO_SYMBOL_ID for ids).
+     */
+    void pad();
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /**
+     * @return size() rounded up to a multiple of COLUMN_PADDING
+     */
+    size_t padded_size() const {
+        return (count_ + COLUMN_PADDING - 1) / COLUMN_PADDING * COLUMN_PADDING;
+    }
+
+    std::string_view message(size_t i) const { return buffer.substr(offsets[i], lengths[i]); }
+    std::string_view symbol(size_t i) const { return buffer.substr(symbol_offsets[i], symbol_lengths[i]); }
+
+private:
+    size_t count_ = 0;
+};
+
+} // namespace simd_parser
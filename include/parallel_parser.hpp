@@ -0,0 +1,122 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include "parser.hpp"
+#include "thread_pool.hpp"
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace simd_parser {
+
+/**
+ * What one worker thread did during a parallel parse.
+ */
+struct ParseWorkerStats {
+    size_t messages = 0;       // Messages parsed
+    size_t bytes = 0;          // Bytes of those messages
+    size_t tasks = 0;          // Chunks parsed
+    size_t steals = 0;         // Chunks taken from other workers' ranges
+    double busy_seconds = 0;   // Time spent inside chunks
+
+    double messages_per_second() const { return busy_seconds > 0 ? messages / busy_seconds : 0.0; }
+    double bytes_per_second() const { return busy_seconds > 0 ? bytes / busy_seconds : 0.0; }
+};
+
+/**
+ * Per-thread throughput breakdown of one ParallelParser call.
+ */
+struct ParallelParseStats {
+    std::vector<ParseWorkerStats> workers;  // Indexed by worker
+    double wall_seconds = 0;                // Whole call, as seen by the caller
+
+    size_t messages() const;
+    size_t bytes() const;
+
+    /**
+     * @return One line per worker (messages, M msg/s, MB/s, chunks, steals)
+     *         and a total line
+     */
+    std::string report() const;
+};
+
+/**
+ * Parses large message sets or whole log buffers on all cores, keeping the
+ * results in input order.
+ *
+ * Input is cut into chunks (CHUNK_MESSAGES messages, or about CHUNK_BYTES
+ * of a buffer) that run as tasks on a work-stealing ThreadPool, so a worker
+ * that finishes early takes chunks from slower ones. Every chunk writes to
+ * its own slice of the output; no locks are taken while parsing. Each worker
+ * has its own ParserContext, so results have no symbol_id.
+ *
+ *   ParallelParser parser;                       // one thread per core
+ *   std::vector<FIXMessage> results;
+ *   auto stats = parser.parse_buffer(log, results);
+ *   std::cout << stats.report();
+ *
+ * A ParallelParser is itself not thread-safe: one call at a time.
+ */
+class ParallelParser {
+public:
+    static constexpr size_t CHUNK_MESSAGES = 512;
+    static constexpr size_t CHUNK_BYTES = 64 * 1024;
+
+    /**
+     * @param threads Worker count; 0 means one per hardware thread
+     */
+    explicit ParallelParser(size_t threads = 0);
+
+    /**
+     * Parses messages[i] into out[i] with parse_simd_batch(), chunk by chunk.
+     *
+     * @param messages FIX messages (fields separated by Delimiter)
+     * @param out Results; must hold at least messages.size() elements
+     * @return Per-thread breakdown
+     */
+    template <char Delimiter = '|'>
+    ParallelParseStats parse(std::span<const std::string_view> messages, std::span<FIXMessage> out);
+
+    /**
+     * Frames and parses a buffer of back-to-back messages (e.g. a FIX log).
+     *
+     * The buffer is cut about every CHUNK_BYTES at the next message start
+     * ("<delim>8=FIX"), so chunks can be framed independently; each chunk
+     * is framed as a complete stream (end_of_stream) and parsed. Results
+     * are concatenated in buffer order.
+     *
+     * @param buffer Stream bytes (fields separated by Delimiter)
+     * @param out Results; replaced with one entry per framed message
+     * @return Per-thread breakdown
+     */
+    template <char Delimiter = '|'>
+    ParallelParseStats parse_buffer(std::string_view buffer, std::vector<FIXMessage>& out);
+
+    size_t thread_count() const { return pool_.size(); }
+
+private:
+    // Written only by its own worker; aligned so workers never share a line
+    struct alignas(64) WorkerState {
+        ParserContext context;
+        ParseWorkerStats stats;
+    };
+
+    void reset_stats();
+    ParallelParseStats collect_stats(double wall_seconds) const;
+
+    ThreadPool pool_;
+    std::vector<WorkerState> workers_;
+    std::vector<size_t> chunk_starts_;                    // parse_buffer() cut points
+    std::vector<std::vector<FIXMessage>> chunk_results_;  // parse_buffer() output per chunk
+};
+
+extern template ParallelParseStats ParallelParser::parse<'|'>(std::span<const std::string_view>,
+                                                              std::span<FIXMessage>);
+extern template ParallelParseStats ParallelParser::parse<SOH>(std::span<const std::string_view>,
+                                                             std::span<FIXMessage>);
+extern template ParallelParseStats ParallelParser::parse_buffer<'|'>(std::string_view, std::vector<FIXMessage>&);
+extern template ParallelParseStats ParallelParser::parse_buffer<SOH>(std::string_view, std::vector<FIXMessage>&);
+
+} // namespace simd_parser
@@ -1,45 +1,353 @@
 #pragma once
 
+#include "field_index.hpp"
 #include "fix_message.hpp"
+#include "framer.hpp"
+#include "lazy_message.hpp"
+#include "market_data.hpp"
+#include "message_batch.hpp"
+#include "simd_utils.hpp"
+#include "symbol_table.hpp"
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace simd_parser {
 
+/**
+ * Reusable scratch buffers for the parsers.
+ *
+ * The parse functions need per-message scratch space (delimiter positions for
+ * the scalar parser, the structural index for the SIMD parser). Keeping it in
+ * a context that outlives individual calls means buffers only grow until they
+ * fit the largest message seen, after which parsing performs zero heap
+ * allocations.
+ *
+ * A context must not be used by two threads at once. Either give each thread
+ * its own context or use thread_parser_context().
+ *
+ * Setting `symbols` makes the parsers that take a context (and the ones
+ * using thread_parser_context()) intern every Symbol into
+ * FIXMessage::symbol_id.
+ */
+struct ParserContext {
+    static constexpr size_t DEFAULT_MAX_MESSAGE_SIZE = 4096;
+
+    std::vector<size_t> delimiters;  // parse_scalar() scratch
+    StructuralIndex index;           // parse_simd() scratch
+    SymbolTable* symbols = nullptr;  // Interns Symbol into symbol_id when set; not owned
+
+    /**
+     * @param max_message_size Largest message expected; buffers are pre-sized
+     *                         so that no message up to this size allocates
+     */
+    explicit ParserContext(size_t max_message_size = DEFAULT_MAX_MESSAGE_SIZE);
+
+    /**
+     * Grows the scratch buffers to fit messages of up to max_message_size bytes.
+     */
+    void reserve(size_t max_message_size);
+};
+
+/**
+ * Returns the calling thread's default parser context.
+ * Used by the parse functions that do not take an explicit context.
+ */
+ParserContext& thread_parser_context();
+
 /**
  * Parses a FIX protocol message using scalar (non-SIMD) implementation.
  * Serves as baseline for performance comparisons.
  *
  * Iterates through the message character-by-character to find delimiters,
- * then extracts tag=value pairs.
+ * then extracts tag=value pairs. Like parse_simd(), a message shorter than
+ * its BodyLength (tag 9) is rejected up front.
+ *
+ * The field delimiter is a template parameter: '|' (the default, used by the
+ * logs in examples/sample_messages.txt) or SOH for wire-format FIX.
  *
- * @param message FIX message string (tags separated by '|')
+ * @param message FIX message string (fields separated by Delimiter)
  * @return Parsed FIXMessage structure
  */
+template <char Delimiter = '|'>
 FIXMessage parse_scalar(std::string_view message);
 
 /**
- * Parses a FIX protocol message using AVX-512 SIMD acceleration.
+ * Parses a FIX message with the scalar implementation, using the caller's
+ * scratch buffers instead of the thread-local context.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @param context Scratch buffers reused across calls
+ * @return Parsed FIXMessage structure
+ */
+template <char Delimiter = '|'>
+FIXMessage parse_scalar(std::string_view message, ParserContext& context);
+
+/**
+ * Parses a FIX protocol message using SIMD acceleration.
+ * Runs on the widest tier the CPU supports (AVX-512, AVX2 or SSE4.2).
  *
  * Optimization strategy:
- * 1. Use SIMD to find all delimiters rapidly (64 bytes at once)
- * 2. Split message into fields based on delimiter positions
- * 3. Parse each field to extract tag and value
- * 4. Populate FIXMessage structure with zero-copy string views
+ * 1. Read BodyLength (tag 9) from the header and reject a message shorter
+ *    than it declares before touching the body
+ * 2. Stage 1: classify 64-byte blocks into delimiter and '=' bitmasks with SIMD,
+ *    summing the bytes with SAD in the same pass
+ * 3. Stage 2: walk fields directly off the bitmasks (no position vector)
+ * 4. Parse each field's tag and value
+ * 5. Populate FIXMessage structure with zero-copy string views
+ * 6. Validate the CheckSum (tag 10) against the stage-1 byte sum
+ *
+ * The delimiter is a compile-time constant, so the broadcast vector and
+ * compares are constants. Use parse_simd<SOH>() for wire-format messages;
+ * no byte rewriting is needed.
  *
  * Performance: ~8x faster than scalar implementation
  *
- * @param message FIX message string (tags separated by '|')
+ * @param message FIX message string (fields separated by Delimiter)
  * @return Parsed FIXMessage structure
  */
+template <char Delimiter = '|'>
 FIXMessage parse_simd(std::string_view message);
 
+/**
+ * Parses a FIX message with SIMD acceleration, using the caller's scratch
+ * buffers instead of the thread-local context.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @param context Scratch buffers reused across calls
+ * @return Parsed FIXMessage structure
+ */
+template <char Delimiter = '|'>
+FIXMessage parse_simd(std::string_view message, ParserContext& context);
+
+/**
+ * Parses a FIX message with SIMD acceleration and also records every field
+ * in `fields`, so tags FIXMessage does not store can be looked up afterwards
+ * without reparsing:
+ *
+ *   FIXMessage msg = parse_simd(raw, context, fields);
+ *   std::string_view cl_ord_id = fields.get(11);
+ *
+ * The index is reset first, even if the message is rejected.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @param context Scratch buffers reused across calls
+ * @param fields Output index; its views point into message
+ * @return Parsed FIXMessage structure
+ */
+template <char Delimiter = '|'>
+FIXMessage parse_simd(std::string_view message, ParserContext& context, FieldIndex& fields);
+
+/**
+ * Parses only the requested fields, stopping as soon as all of them have
+ * been seen:
+ *
+ *   FIXMessage m = parse_simd(message, FieldMask{FIXTag::MessageType, FIXTag::Symbol});
+ *
+ * The message is classified in doubling windows (64, 128, 256, ... bytes),
+ * so when the requested fields sit near the start, the bytes after them are
+ * never scanned. Fields outside the mask are left at their defaults and
+ * not converted. Unlike the full parse, the first occurrence of a repeated
+ * tag wins.
+ *
+ * valid is true when every requested field was found (not, as in the full
+ * parse, when MsgType and Symbol are present). A message shorter than its
+ * BodyLength is rejected.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @param fields Fields to extract
+ * @return FIXMessage with the requested fields filled in
+ */
+template <char Delimiter = '|'>
+FIXMessage parse_simd(std::string_view message, FieldMask fields);
+
+/**
+ * Field-selective parse_simd() with the caller's scratch buffers.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @param context Scratch buffers reused across calls
+ * @param fields Fields to extract
+ * @return FIXMessage with the requested fields filled in
+ */
+template <char Delimiter = '|'>
+FIXMessage parse_simd(std::string_view message, ParserContext& context, FieldMask fields);
+
+/**
+ * Parses a FIX message with SIMD acceleration, recording where each stored
+ * field is but deferring numeric conversion (Side, Price, OrderQty,
+ * BodyLength) until the field is first read.
+ *
+ * Use it when most messages are only inspected for a few string fields, e.g.
+ * routing on MsgType and TargetCompID. CheckSum is still validated during
+ * the scan. A message shorter than its BodyLength comes back empty.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @return Lazily decoded message; views point into message
+ */
+template <char Delimiter = '|'>
+LazyFIXMessage parse_lazy(std::string_view message);
+
+/**
+ * parse_lazy() with the caller's scratch buffers instead of the
+ * thread-local context.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @param context Scratch buffers reused across calls
+ * @return Lazily decoded message; views point into message
+ */
+template <char Delimiter = '|'>
+LazyFIXMessage parse_lazy(std::string_view message, ParserContext& context);
+
+/**
+ * Messages parse_simd_batch() scans before converting their numeric fields.
+ * Two vectors' worth of values per field per conversion call.
+ */
+constexpr size_t BATCH_CONVERT_SIZE = 16;
+
+/**
+ * Parses a batch of messages, converting numeric fields across messages
+ * instead of one message at a time.
+ *
+ * Messages are scanned BATCH_CONVERT_SIZE at a time as in parse_lazy(),
+ * which locates Side, Price, OrderQty and BodyLength without converting
+ * them; each field is then converted for the whole group with
+ * parse_int_batch() / parse_price_batch(), eight values per vector on
+ * AVX-512. out[i] ends up equal to parse_simd(messages[i]).
+ *
+ * @param messages FIX messages (fields separated by Delimiter)
+ * @param context Scratch buffers reused across calls
+ * @param out Results; must hold at least messages.size() elements
+ */
+template <char Delimiter = '|'>
+void parse_simd_batch(std::span<const std::string_view> messages, ParserContext& context,
+                      std::span<FIXMessage> out);
+
+/**
+ * Frames and parses a whole receive buffer into struct-of-arrays columns:
+ *
+ *   FrameResult r = parse_batch(recv_buffer, context, batch);
+ *   // batch.prices[i], batch.quantities[i], batch.symbol(i), ...
+ *   // keep recv_buffer[r.consumed..] for the next read
+ *
+ * Messages are split with frame_messages() BATCH_CONVERT_SIZE at a time and
+ * scanned as in parse_simd_batch(); Side, Price and OrderQty are then
+ * converted across the group straight into their columns. Each row matches
+ * parse_simd() of that message. As with frame_messages(), the last message
+ * is held back unless its trailer has arrived or end_of_stream is set.
+ *
+ * @param buffer Stream bytes (fields separated by Delimiter), under 4 GiB
+ * @param context Scratch buffers reused across calls; its SymbolTable, if
+ *                any, fills batch.symbol_ids
+ * @param out Output columns; reset first, padded to a multiple of
+ *            MessageBatch::COLUMN_PADDING on return
+ * @param end_of_stream Treat the end of buffer as the end of the last message
+ * @return Number of messages parsed and number of bytes consumed
+ */
+template <char Delimiter = '|'>
+FrameResult parse_batch(std::string_view buffer, ParserContext& context, MessageBatch& out,
+                        bool end_of_stream = false);
+
+/**
+ * parse_batch() with the thread-local context.
+ *
+ * @param buffer Stream bytes (fields separated by Delimiter), under 4 GiB
+ * @param out Output columns
+ * @param end_of_stream Treat the end of buffer as the end of the last message
+ * @return Number of messages parsed and number of bytes consumed
+ */
+template <char Delimiter = '|'>
+FrameResult parse_batch(std::string_view buffer, MessageBatch& out, bool end_of_stream = false);
+
+/**
+ * Parses a MarketDataIncrementalRefresh (35=X), writing its NoMDEntries
+ * (268) group into struct-of-arrays columns instead of letting each repeated
+ * tag overwrite the last.
+ *
+ * Fields before tag 268 fill the returned FIXMessage as usual. The first tag
+ * after 268 delimits entries (279 for conforming senders); tags 279, 269,
+ * 270, 271 and 55 of each entry go to the matching column, other group
+ * fields are skipped. The group ends at the CheckSum trailer.
+ *
+ * The message is valid if it is 35=X and the number of entries matches
+ * NoMDEntries. FIXMessage::symbol is only set by a symbol before the group.
+ *
+ * @param message FIX message string (fields separated by Delimiter)
+ * @param context Scratch buffers reused across calls
+ * @param entries Output columns; cleared first, padded to a multiple of
+ *                MarketDataEntries::COLUMN_PADDING on return
+ * @return Header fields and validity
+ */
+template <char Delimiter = '|'>
+FIXMessage parse_market_data(std::string_view message, ParserContext& context,
+                             MarketDataEntries& entries);
+
 /**
  * Automatically selects the best parser implementation based on CPU capabilities.
- * Falls back to scalar if AVX-512 is not available.
+ * Uses the widest available SIMD tier and falls back to scalar only if the
+ * CPU has none of AVX-512, AVX2 or SSE4.2.
  *
- * @param message FIX message string
+ * @param message FIX message string (fields separated by Delimiter)
  * @return Parsed FIXMessage structure
  */
+template <char Delimiter = '|'>
 FIXMessage parse_auto(std::string_view message);
 
+// The parsers are instantiated for the two delimiters seen in practice
+extern template FIXMessage parse_scalar<'|'>(std::string_view);
+extern template FIXMessage parse_scalar<SOH>(std::string_view);
+extern template FIXMessage parse_scalar<'|'>(std::string_view, ParserContext&);
+extern template FIXMessage parse_scalar<SOH>(std::string_view, ParserContext&);
+extern template FIXMessage parse_simd<'|'>(std::string_view);
+extern template FIXMessage parse_simd<SOH>(std::string_view);
+extern template FIXMessage parse_simd<'|'>(std::string_view, ParserContext&);
+extern template FIXMessage parse_simd<SOH>(std::string_view, ParserContext&);
+extern template FIXMessage parse_simd<'|'>(std::string_view, ParserContext&, FieldIndex&);
+extern template FIXMessage parse_simd<SOH>(std::string_view, ParserContext&, FieldIndex&);
+extern template FIXMessage parse_simd<'|'>(std::string_view, FieldMask);
+extern template FIXMessage parse_simd<SOH>(std::string_view, FieldMask);
+extern template FIXMessage parse_simd<'|'>(std::string_view, ParserContext&, FieldMask);
+extern template FIXMessage parse_simd<SOH>(std::string_view, ParserContext&, FieldMask);
+extern template LazyFIXMessage parse_lazy<'|'>(std::string_view);
+extern template LazyFIXMessage parse_lazy<SOH>(std::string_view);
+extern template LazyFIXMessage parse_lazy<'|'>(std::string_view, ParserContext&);
+extern template LazyFIXMessage parse_lazy<SOH>(std::string_view, ParserContext&);
+extern template void parse_simd_batch<'|'>(std::span<const std::string_view>, ParserContext&,
+                                          std::span<FIXMessage>);
+extern template void parse_simd_batch<SOH>(std::span<const std::string_view>, ParserContext&,
+                                         std::span<FIXMessage>);
+extern template FrameResult parse_batch<'|'>(std::string_view, ParserContext&, MessageBatch&, bool);
+extern template FrameResult parse_batch<SOH>(std::string_view, ParserContext&, MessageBatch&, bool);
+extern template FrameResult parse_batch<'|'>(std::string_view, MessageBatch&, bool);
+extern template FrameResult parse_batch<SOH>(std::string_view, MessageBatch&, bool);
+extern template FIXMessage parse_market_data<'|'>(std::string_view, ParserContext&, MarketDataEntries&);
+extern template FIXMessage parse_market_data<SOH>(std::string_view, ParserContext&, MarketDataEntries&);
+extern template FIXMessage parse_auto<'|'>(std::string_view);
+extern template FIXMessage parse_auto<SOH>(std::string_view);
+
+/**
+ * Sniffs the field delimiter of a FIX stream.
+ *
+ * Call once on the first bytes of a stream: the delimiter is the first SOH
+ * or '|' byte, which for a well-formed message terminates "8=FIX.x.y".
+ *
+ * @param data Start of the stream
+ * @return SOH or '|', or '\0' if neither appears in data
+ */
+char detect_delimiter(std::string_view data);
+
+/**
+ * Signature shared by the parse_auto() specializations.
+ */
+using ParseFunction = FIXMessage (*)(std::string_view);
+
+/**
+ * Returns the parse_auto() specialization for a delimiter, so a stream reader
+ * can sniff the delimiter once and then parse every message without a
+ * per-message branch.
+ *
+ * @param delimiter Delimiter returned by detect_delimiter()
+ * @return Matching parser, or nullptr if the delimiter is not supported
+ */
+ParseFunction parser_for_delimiter(char delimiter);
+
 } // namespace simd_parser
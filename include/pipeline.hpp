@@ -0,0 +1,172 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace simd_parser {
+
+/**
+ * Sizing of a ParsePipeline.
+ */
+struct PipelineOptions {
+    size_t parser_threads = 2;        // Parser threads (shards in run_sharded())
+    size_t ring_capacity = 1024;      // Entries per ring
+    size_t batch_size = 32;           // Entries moved per publish / consume
+    size_t block_bytes = 64 * 1024;   // Input block size; longer messages are truncated
+    size_t block_count = 32;          // Input blocks in flight (at least 2)
+};
+
+/**
+ * One parsed message as handed to the consumer.
+ */
+struct ParsedRecord {
+    uint64_t sequence = 0;   // Position in the input stream (0, 1, 2, ...)
+    uint32_t parser = 0;     // Parser thread (shard in run_sharded()) that produced it
+    uint32_t block = 0;      // Input block holding the message bytes
+    FIXMessage message;      // Views valid until the consumer callback returns
+};
+
+/**
+ * Counters of one ParsePipeline::run().
+ */
+struct PipelineStats {
+    size_t bytes = 0;             // Bytes read from the source
+    size_t messages = 0;          // Records delivered to the consumer
+    size_t blocks = 0;            // Input blocks handed to the parsers
+    size_t consumer_batches = 0;  // Consumer callback invocations
+    size_t ingest_waits = 0;      // Ingest found every parser ring full or no free block
+    size_t parser_waits = 0;      // A parser found the output ring full
+    double wall_seconds = 0;
+
+    double messages_per_second() const { return wall_seconds > 0 ? messages / wall_seconds : 0.0; }
+};
+
+/**
+ * Ingest → parse → consume pipeline connected by lock-free rings.
+ *
+ *   ingest (caller's thread)  ──SPSC──▶  parser 0 ──┐
+ *     reads the source into    ──SPSC──▶  parser 1 ──┼──MPSC──▶ consumer
+ *     blocks and frames them   ──SPSC──▶  parser N ──┘            │
+ *          ▲                                                     │
+ *          └───────────────── MPSC (free blocks) ◀───────────────┘
+ *
+ * The ingest stage reads raw bytes into fixed-size blocks, frames complete
+ * messages with frame_messages() and deals them out in batches of
+ * batch_size to the parser rings (round-robin, skipping full rings). An
+ * incomplete trailing message is copied to the start of the next block.
+ * Parser threads run parse_auto() and publish ParsedRecord batches to one
+ * multi-producer ring; the consumer thread drains it in batches and calls
+ * the consumer callback. Once every message of a block has been consumed,
+ * the block returns to ingest through the free ring, so the message bytes
+ * are never copied and nothing is allocated while running.
+ *
+ * No stage takes a lock: a stage that finds its ring empty or full spins
+ * briefly and then yields (see Backoff).
+ *
+ * Records of one parser reach the consumer in stream order, but parsers
+ * interleave; use ParsedRecord::sequence to restore stream order, or run a
+ * single parser thread.
+ *
+ * run_sharded() instead routes each message to the shard thread that owns
+ * its symbol (scan_symbol() and symbol_shard() on the ingest thread, no
+ * parse) and each shard parses with parse_simd() and calls the consumer
+ * itself. All messages of an instrument then pass through one thread in
+ * stream order, so per-instrument state can be kept per shard without any
+ * synchronization:
+ *
+ *   std::vector<Books> books(options.parser_threads);
+ *   pipeline.run_sharded(source, [&](uint32_t shard, auto records) {
+ *       for (const ParsedRecord& r : records) books[shard].apply(r.message);
+ *   });
+ */
+class ParsePipeline {
+public:
+    /**
+     * Fills a buffer with the next bytes of the stream.
+     *
+     * @return Bytes written; 0 marks the end of the stream
+     */
+    using Source = std::function<size_t(std::span<char> buffer)>;
+
+    /**
+     * Receives parsed records on the consumer thread. Must not throw.
+     */
+    using Consumer = std::function<void(std::span<const ParsedRecord> records)>;
+
+    /**
+     * Receives one shard's parsed records on that shard's thread; different
+     * shards call it concurrently. Must not throw.
+     */
+    using ShardConsumer = std::function<void(uint32_t shard, std::span<const ParsedRecord> records)>;
+
+    explicit ParsePipeline(const PipelineOptions& options = PipelineOptions());
+    ~ParsePipeline();
+
+    ParsePipeline(const ParsePipeline&) = delete;
+    ParsePipeline& operator=(const ParsePipeline&) = delete;
+
+    /**
+     * Runs the pipeline until the source is exhausted and every record has
+     * been consumed. The calling thread is the ingest stage; parser and
+     * consumer threads are started for the run.
+     *
+     * @param source Byte source, called on the calling thread
+     * @param consumer Record sink, called on the consumer thread
+     * @return Counters for the run
+     */
+    template <char Delimiter = '|'>
+    PipelineStats run(const Source& source, const Consumer& consumer);
+
+    /**
+     * Runs the pipeline with one shard per parser thread and no consumer
+     * thread. Records of a symbol always go to the same shard, in stream
+     * order; the shard's records carry symbol_id from a SymbolTable private
+     * to that shard. Messages without a symbol go to shard 0.
+     *
+     * @param source Byte source, called on the calling thread
+     * @param consumer Record sink, called on the shard threads
+     * @return Counters for the run (parser_waits is always 0)
+     */
+    template <char Delimiter = '|'>
+    PipelineStats run_sharded(const Source& source, const ShardConsumer& consumer);
+
+    const PipelineOptions& options() const { return options_; }
+
+private:
+    struct Rings;
+
+    // Written once by a shard thread when it finishes
+    struct alignas(64) ShardCounters {
+        size_t messages = 0;
+        size_t batches = 0;
+    };
+
+    template <char Delimiter, typename Dispatch>
+    void ingest(Rings& rings, const Source& source, Dispatch&& dispatch, PipelineStats& stats);
+    template <char Delimiter>
+    void parser_loop(Rings& rings, uint32_t parser, size_t& waits);
+    void consumer_loop(Rings& rings, const Consumer& consumer, PipelineStats& stats);
+    template <char Delimiter>
+    void shard_loop(Rings& rings, uint32_t shard, const ShardConsumer& consumer, ShardCounters& counters);
+    void release_blocks(Rings& rings, std::span<const ParsedRecord> records);
+
+    char* block_data(uint32_t block) { return blocks_.get() + static_cast<size_t>(block) * options_.block_bytes; }
+
+    PipelineOptions options_;
+    std::unique_ptr<char[]> blocks_;                    // block_count * block_bytes
+    std::unique_ptr<std::atomic<uint32_t>[]> pending_;  // Unconsumed messages per block
+};
+
+extern template PipelineStats ParsePipeline::run<'|'>(const Source&, const Consumer&);
+extern template PipelineStats ParsePipeline::run<SOH>(const Source&, const Consumer&);
+extern template PipelineStats ParsePipeline::run_sharded<'|'>(const Source&, const ShardConsumer&);
+extern template PipelineStats ParsePipeline::run_sharded<SOH>(const Source&, const ShardConsumer&);
+
+} // namespace simd_parser
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <immintrin.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <utility>
+
+namespace simd_parser {
+
+/**
+ * Spin-then-yield wait for polling a ring that is empty or full. Pausing
+ * keeps the first few retries cheap on a busy core; yielding afterwards lets
+ * the other side run when threads outnumber cores.
+ */
+class Backoff {
+public:
+    static constexpr uint32_t SPIN_LIMIT = 64;
+
+    void wait() {
+        if (spins_ < SPIN_LIMIT) {
+            _mm_pause();
+            ++spins_;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    void reset() { spins_ = 0; }
+
+private:
+    uint32_t spins_ = 0;
+};
+
+/**
+ * Bounded single-producer single-consumer ring.
+ *
+ * The producer owns tail_ and the consumer owns head_; each sits on its own
+ * cache line together with that side's cached copy of the other index, so
+ * the shared line is only read when the cached copy says the ring looks
+ * full (or empty). A batch of any size is published with one release store
+ * and consumed with one acquire load.
+ *
+ * Indices run freely and are masked into a power-of-two slot array.
+ *
+ * @tparam T Default-constructible, movable element
+ */
+template <typename T>
+class alignas(64) SpscRing {
+public:
+    /**
+     * @param capacity Minimum number of elements; rounded up to a power of two
+     */
+    explicit SpscRing(size_t capacity)
+        : mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+          slots_(std::make_unique<T[]>(mask_ + 1)) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * Producer only. Copies as many leading items as fit and publishes them
+     * together.
+     *
+     * @return Number of items pushed (0 if the ring is full)
+     */
+    size_t try_push(std::span<const T> items) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t free = capacity() - (tail - cached_head_);
+        if (free < items.size()) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = capacity() - (tail - cached_head_);
+        }
+        const size_t count = std::min(free, items.size());
+        for (size_t i = 0; i < count; ++i) {
+            slots_[(tail + i) & mask_] = items[i];
+        }
+        if (count > 0) {
+            tail_.store(tail + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    bool try_push(const T& item) { return try_push(std::span<const T>(&item, 1)) == 1; }
+
+    /**
+     * Consumer only. Moves up to out.size() items out and frees their slots
+     * together.
+     *
+     * @return Number of items popped (0 if the ring is empty)
+     */
+    size_t try_pop(std::span<T> out) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        size_t available = cached_tail_ - head;
+        if (available < out.size()) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            available = cached_tail_ - head;
+        }
+        const size_t count = std::min(available, out.size());
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = std::move(slots_[(head + i) & mask_]);
+        }
+        if (count > 0) {
+            head_.store(head + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    bool try_pop(T& item) { return try_pop(std::span<T>(&item, 1)) == 1; }
+
+    size_t capacity() const { return mask_ + 1; }
+
+    /**
+     * @return Element count; exact only when called by a side while the
+     *         other side is idle
+     */
+    size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    // Consumer line
+    alignas(64) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    // Producer line
+    alignas(64) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+
+    // Read-only after construction
+    alignas(64) const size_t mask_;
+    const std::unique_ptr<T[]> slots_;
+};
+
+/**
+ * Bounded multi-producer single-consumer ring.
+ *
+ * Every slot carries a sequence number (Vyukov's bounded queue): slot i is
+ * free for position p when its sequence equals p and holds an element when
+ * it equals p + 1. A producer claims a run of consecutive free slots with
+ * one CAS on tail_, then fills and publishes them slot by slot, so producers
+ * never wait for each other. The consumer pops the ready run at head_ and
+ * hands each slot back for the next lap.
+ *
+ * @tparam T Default-constructible, movable element
+ */
+template <typename T>
+class alignas(64) MpscRing {
+public:
+    /**
+     * @param capacity Minimum number of elements; rounded up to a power of two
+     */
+    explicit MpscRing(size_t capacity)
+        : mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+          slots_(std::make_unique<Slot[]>(mask_ + 1)) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    /**
+     * Any thread. Claims as many consecutive slots as are free (up to
+     * items.size()) and fills them with the leading items.
+     *
+     * @return Number of items pushed (0 if the ring is full)
+     */
+    size_t try_push(std::span<const T> items) {
+        if (items.empty()) {
+            return 0;
+        }
+        size_t position = tail_.load(std::memory_order_relaxed);
+        size_t count;
+        for (;;) {
+            count = 0;
+            while (count < items.size() && sequence_at(position + count) == position + count) {
+                ++count;
+            }
+            if (count == 0) {
+                // Behind position: the consumer has not freed it yet (full).
+                // Ahead of it: another producer claimed it; retry from tail_.
+                if (static_cast<intptr_t>(sequence_at(position) - position) < 0) {
+                    return 0;
+                }
+                position = tail_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (tail_.compare_exchange_weak(position, position + count, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            Slot& slot = slots_[(position + i) & mask_];
+            slot.value = items[i];
+            slot.sequence.store(position + i + 1, std::memory_order_release);
+        }
+        return count;
+    }
+
+    bool try_push(const T& item) { return try_push(std::span<const T>(&item, 1)) == 1; }
+
+    /**
+     * Consumer only. Moves out the run of published elements at the head,
+     * up to out.size(); stops at a slot that is claimed but not yet filled.
+     *
+     * @return Number of items popped (0 if none is ready)
+     */
+    size_t try_pop(std::span<T> out) {
+        size_t count = 0;
+        while (count < out.size()) {
+            Slot& slot = slots_[(head_ + count) & mask_];
+            if (slot.sequence.load(std::memory_order_acquire) != head_ + count + 1) {
+                break;
+            }
+            out[count] = std::move(slot.value);
+            slot.sequence.store(head_ + count + capacity(), std::memory_order_release);
+            ++count;
+        }
+        head_ += count;
+        return count;
+    }
+
+    bool try_pop(T& item) { return try_pop(std::span<T>(&item, 1)) == 1; }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    size_t sequence_at(size_t position) const {
+        return slots_[position & mask_].sequence.load(std::memory_order_acquire);
+    }
+
+    // Shared by producers
+    alignas(64) std::atomic<size_t> tail_{0};
+
+    // Consumer only
+    alignas(64) size_t head_ = 0;
+
+    // Read-only after construction
+    alignas(64) const size_t mask_;
+    const std::unique_ptr<Slot[]> slots_;
+};
+
+} // namespace simd_parser
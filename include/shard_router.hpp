@@ -0,0 +1,49 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include "simd_utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace simd_parser {
+
+/**
+ * Finds the Symbol (55) value of a message without parsing it.
+ *
+ * Looks for "<delim>55=" with one compare per pattern byte at four
+ * consecutive offsets (64 positions per AVX-512 step, 32 per AVX2 step),
+ * which is much cheaper than a field walk when only the routing key is
+ * needed.
+ *
+ * @param message FIX message (fields separated by Delimiter)
+ * @return Symbol value, or empty if the message has no tag 55
+ */
+template <char Delimiter = '|'>
+std::string_view scan_symbol(std::string_view message);
+
+/**
+ * scan_symbol() on a specific tier, for testing and benchmarking. The tier
+ * must be supported by the CPU (see cpu_features()).
+ */
+template <char Delimiter = '|'>
+std::string_view scan_symbol(std::string_view message, SimdLevel level);
+
+/**
+ * Shard that owns a symbol. The symbol is hashed to 32 bits and shard i
+ * owns the i-th of `shards` equal ranges of the hash, so a symbol always
+ * maps to the same shard and symbols spread evenly. Messages without a
+ * symbol go to shard 0.
+ *
+ * @param symbol Symbol value (e.g. from scan_symbol())
+ * @param shards Shard count (at least 1)
+ * @return Shard index below shards
+ */
+uint32_t symbol_shard(std::string_view symbol, size_t shards);
+
+extern template std::string_view scan_symbol<'|'>(std::string_view);
+extern template std::string_view scan_symbol<SOH>(std::string_view);
+extern template std::string_view scan_symbol<'|'>(std::string_view, SimdLevel);
+extern template std::string_view scan_symbol<SOH>(std::string_view, SimdLevel);
+
+} // namespace simd_parser
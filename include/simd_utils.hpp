@@ -1,12 +1,56 @@
 #pragma once
 
+#include "decimal.hpp"
 #include <string_view>
+#include <span>
+#include <type_traits>
 #include <vector>
 #include <cstddef>
 #include <cstdint>
 
 namespace simd_parser {
 
+/**
+ * Delimiter-scanning tiers, ordered from narrowest to widest.
+ */
+enum class SimdLevel : uint8_t {
+    Scalar = 0,   // 1 byte per iteration
+    SSE42 = 1,    // 16 bytes per iteration
+    AVX2 = 2,     // 32 bytes per iteration
+    AVX512 = 3,   // 64 bytes per iteration (AVX512F + AVX512BW)
+    AVX512VBMI2 = 4,  // AVX512 plus vpcompressb position extraction (Ice Lake+)
+};
+
+/**
+ * CPU features relevant to the parser.
+ * Each flag is only set if both the CPU and the OS (XSAVE state) support it.
+ */
+struct CpuFeatures {
+    bool sse42 = false;
+    bool avx2 = false;
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512vbmi2 = false;
+
+    /**
+     * @return Widest delimiter-scanning tier usable on this CPU
+     */
+    SimdLevel best_level() const;
+};
+
+/**
+ * Returns the features of the current CPU.
+ * Detection (CPUID + XGETBV) runs once; later calls return the cached result.
+ *
+ * @return Detected CPU features
+ */
+const CpuFeatures& cpu_features();
+
+/**
+ * Returns a human-readable name for a SIMD tier (e.g. "AVX2").
+ */
+const char* simd_level_name(SimdLevel level);
+
 /**
  * Checks if the current CPU supports AVX-512 instructions.
  * Uses CPUID to detect AVX512F and AVX512BW features.
@@ -25,9 +69,34 @@ bool has_avx512_support();
  */
 std::vector<size_t> find_delimiters_scalar(std::string_view data, char delimiter);
 
+/**
+ * Allocation-free variant of find_delimiters_scalar().
+ * Clears `positions` and fills it, reusing its existing capacity.
+ *
+ * @param data String to search
+ * @param delimiter Character to find
+ * @param positions Output vector (cleared first)
+ */
+void find_delimiters_scalar(std::string_view data, char delimiter, std::vector<size_t>& positions);
+
+/**
+ * Finds all delimiter positions using SSE4.2 (16 bytes per iteration).
+ * Must only be called when cpu_features().sse42 is set.
+ */
+std::vector<size_t> find_delimiters_sse42(std::string_view data, char delimiter);
+void find_delimiters_sse42(std::string_view data, char delimiter, std::vector<size_t>& positions);
+
+/**
+ * Finds all delimiter positions using AVX2 (32 bytes per iteration).
+ * Must only be called when cpu_features().avx2 is set.
+ */
+std::vector<size_t> find_delimiters_avx2(std::string_view data, char delimiter);
+void find_delimiters_avx2(std::string_view data, char delimiter, std::vector<size_t>& positions);
+
 /**
  * Finds all delimiter positions using AVX-512 SIMD instructions.
  * Processes 64 bytes at a time using vector comparisons.
+ * Must only be called when has_avx512_support() is true.
  *
  * Algorithm:
  * 1. Load 64 bytes into zmm register (_mm512_loadu_si512)
@@ -40,17 +109,308 @@ std::vector<size_t> find_delimiters_scalar(std::string_view data, char delimiter
  * @param delimiter Character to find
  * @return Vector of positions where delimiter occurs
  */
+std::vector<size_t> find_delimiters_avx512(std::string_view data, char delimiter);
+void find_delimiters_avx512(std::string_view data, char delimiter, std::vector<size_t>& positions);
+
+/**
+ * Finds all delimiter positions using AVX-512 VBMI2.
+ * Must only be called when cpu_features().avx512vbmi2 is set.
+ *
+ * Instead of one ctz per match, each 64-byte block's match mask drives
+ * vpcompressb over a 0..63 lane-index vector. That packs every match offset
+ * of the block into the low lanes in one instruction; the offsets are then
+ * widened, rebased and written with masked stores.
+ *
+ * @param data String to search
+ * @param delimiter Character to find
+ * @return Vector of positions where delimiter occurs
+ */
+std::vector<size_t> find_delimiters_avx512_vbmi2(std::string_view data, char delimiter);
+void find_delimiters_avx512_vbmi2(std::string_view data, char delimiter, std::vector<size_t>& positions);
+
+/**
+ * Finds all delimiter positions using the widest SIMD tier the CPU supports
+ * (AVX-512 VBMI2, then AVX-512, AVX2, SSE4.2, then scalar).
+ * The tier is selected once on first use.
+ *
+ * @param data String to search
+ * @param delimiter Character to find
+ * @return Vector of positions where delimiter occurs
+ */
 std::vector<size_t> find_delimiters_simd(std::string_view data, char delimiter);
 
+/**
+ * Allocation-free variant of find_delimiters_simd().
+ * Clears `positions` and fills it, reusing its existing capacity.
+ */
+void find_delimiters_simd(std::string_view data, char delimiter, std::vector<size_t>& positions);
+
+/**
+ * Largest input the 16-bit position overloads accept (positions 0..65535).
+ */
+constexpr size_t MAX_UINT16_SCAN_SIZE = 65536;
+
+/**
+ * Returned by the 16-bit position overloads when the input is longer than
+ * MAX_UINT16_SCAN_SIZE. Always larger than any output span, so callers that
+ * check `count > out.size()` treat it as an overflow.
+ */
+constexpr size_t DELIMITER_SCAN_TOO_LARGE = static_cast<size_t>(-1);
+
+/**
+ * Finds delimiter positions into a caller-provided buffer (scalar).
+ *
+ * Positions are written as 32-bit offsets, halving memory traffic compared
+ * with size_t. Nothing is allocated.
+ *
+ * @param data String to search
+ * @param delimiter Character to find
+ * @param out Destination for positions, in ascending order
+ * @return Total number of delimiters in data. If this exceeds out.size(),
+ *         the buffer overflowed and only the first out.size() positions
+ *         were written.
+ */
+size_t find_delimiters_scalar(std::string_view data, char delimiter, std::span<uint32_t> out);
+
+/**
+ * 16-bit position variant of the span-based scalar finder, for inputs of up
+ * to MAX_UINT16_SCAN_SIZE bytes (returns DELIMITER_SCAN_TOO_LARGE otherwise).
+ */
+size_t find_delimiters_scalar(std::string_view data, char delimiter, std::span<uint16_t> out);
+
+/**
+ * Finds delimiter positions into a caller-provided buffer using the widest
+ * SIMD tier available.
+ *
+ * Matches are computed as 64-bit block masks on the stack and extracted
+ * straight into `out`; once it is full, the remaining matches are counted
+ * with popcount instead of written.
+ *
+ * @param data String to search
+ * @param delimiter Character to find
+ * @param out Destination for positions, in ascending order
+ * @return Total number of delimiters in data. If this exceeds out.size(),
+ *         the buffer overflowed and only the first out.size() positions
+ *         were written.
+ */
+size_t find_delimiters_simd(std::string_view data, char delimiter, std::span<uint32_t> out);
+
+/**
+ * 16-bit position variant of the span-based SIMD finder, for inputs of up
+ * to MAX_UINT16_SCAN_SIZE bytes (returns DELIMITER_SCAN_TOO_LARGE otherwise).
+ */
+size_t find_delimiters_simd(std::string_view data, char delimiter, std::span<uint16_t> out);
+
+/**
+ * Span-based delimiter finders on a specific tier, for testing and
+ * benchmarking. The tier must be supported by the CPU (see cpu_features()).
+ */
+size_t find_delimiters_simd(std::string_view data, char delimiter, std::span<uint32_t> out,
+                            SimdLevel level);
+size_t find_delimiters_simd(std::string_view data, char delimiter, std::span<uint16_t> out,
+                            SimdLevel level);
+
+/**
+ * Computes one 64-bit match mask per 64-byte block of data, using the widest
+ * SIMD tier available: bit (i % 64) of masks[i / 64] is set iff
+ * data[i] == needle. Bits past the end of data are zero.
+ *
+ * @param data Buffer to scan
+ * @param needle Byte to match
+ * @param masks Output; must hold (data.size() + 63) / 64 entries
+ */
+void build_match_masks(std::string_view data, char needle, uint64_t* masks);
+
+/**
+ * Stage-1 structural index of a FIX buffer.
+ *
+ * Holds one bit per input byte for the field delimiter and for '=':
+ * bit (i % 64) of delimiter_masks[i / 64] is set iff data[i] == delimiter.
+ * Bits past the end of the input are always zero.
+ *
+ * The vectors keep their capacity between builds, so re-indexing messages of
+ * similar size does not allocate.
+ */
+struct StructuralIndex {
+    std::vector<uint64_t> delimiter_masks;
+    std::vector<uint64_t> equals_masks;
+    size_t length = 0;      // Number of input bytes indexed
+    uint32_t byte_sum = 0;  // Sum of all indexed bytes (mod 2^32), for the CheckSum
+
+    size_t block_count() const { return (length + 63) / 64; }
+};
+
+/**
+ * Builds the stage-1 structural index using the widest SIMD tier available.
+ * Each 64-byte block is classified with two vector compares and stored as raw
+ * bitmasks; no positions are extracted. The same loads feed a SAD byte sum,
+ * so the CheckSum (tag 10) comes out of this pass for free.
+ *
+ * @param data Buffer to index
+ * @param delimiter Field delimiter ('|' or SOH)
+ * @param index Output index (resized to data.size())
+ */
+void build_structural_index(std::string_view data, char delimiter, StructuralIndex& index);
+
+/**
+ * Builds the stage-1 structural index using a specific tier.
+ * The tier must be supported by the CPU (see cpu_features()).
+ */
+void build_structural_index(std::string_view data, char delimiter, StructuralIndex& index,
+                            SimdLevel level);
+
+/**
+ * Builds the stage-1 structural index for a delimiter known at compile time.
+ * The delimiter broadcast and compares become constants in every tier.
+ * Instantiated for '|' (readable logs) and SOH '\x01' (FIX wire format).
+ */
+template <char Delimiter>
+void build_structural_index(std::string_view data, StructuralIndex& index);
+
+extern template void build_structural_index<'|'>(std::string_view, StructuralIndex&);
+extern template void build_structural_index<'\x01'>(std::string_view, StructuralIndex&);
+
+/**
+ * Stage-2 field walker.
+ *
+ * Walks the delimiter bitmasks of a structural index and calls
+ * visit(tag, value) for every "tag=value" field, in message order. The first
+ * '=' of each field is taken from the equals bitmasks, so no byte of the
+ * message is re-scanned. Empty fields, fields without '=' and fields with an
+ * empty tag are skipped.
+ *
+ * A visitor returning bool stops the walk by returning false.
+ *
+ * @param data Buffer the index was built from
+ * @param index Stage-1 index of data
+ * @param visit Callable taking (std::string_view tag, std::string_view value)
+ */
+template <typename Visitor>
+void for_each_field(std::string_view data, const StructuralIndex& index, Visitor&& visit) {
+    constexpr size_t NO_EQUALS = static_cast<size_t>(-1);
+    constexpr bool can_stop =
+        std::is_same_v<std::invoke_result_t<Visitor&, std::string_view, std::string_view>, bool>;
+
+    // Bits at or above position `from` within a 64-bit block
+    auto bits_from = [](size_t from) -> uint64_t {
+        return from >= 64 ? 0 : ~uint64_t{0} << from;
+    };
+
+    size_t field_start = 0;
+    size_t equals_pos = NO_EQUALS;
+
+    // Returns false once the visitor asks to stop
+    auto emit = [&](size_t field_end) -> bool {
+        if (equals_pos != NO_EQUALS && equals_pos > field_start) {
+            std::string_view tag = data.substr(field_start, equals_pos - field_start);
+            std::string_view value = data.substr(equals_pos + 1, field_end - equals_pos - 1);
+            if constexpr (can_stop) {
+                return visit(tag, value);
+            } else {
+                visit(tag, value);
+            }
+        }
+        return true;
+    };
+
+    const size_t blocks = index.block_count();
+    for (size_t block = 0; block < blocks; ++block) {
+        const size_t base = block * 64;
+        const uint64_t equals = index.equals_masks[block];
+        uint64_t delimiters = index.delimiter_masks[block];
+
+        while (delimiters != 0) {
+            const size_t offset = __builtin_ctzll(delimiters);
+
+            if (equals_pos == NO_EQUALS) {
+                // First '=' between the field start and this delimiter
+                const size_t start_offset = field_start > base ? field_start - base : 0;
+                const uint64_t candidates =
+                    equals & bits_from(start_offset) & ((uint64_t{1} << offset) - 1);
+                if (candidates != 0) {
+                    equals_pos = base + __builtin_ctzll(candidates);
+                }
+            }
+
+            if (!emit(base + offset)) {
+                return;
+            }
+            field_start = base + offset + 1;
+            equals_pos = NO_EQUALS;
+            delimiters &= delimiters - 1;
+        }
+
+        // The open field continues into the next block; remember its '=' if
+        // it appears in this block
+        if (equals_pos == NO_EQUALS) {
+            const size_t start_offset = field_start > base ? field_start - base : 0;
+            const uint64_t candidates = equals & bits_from(start_offset);
+            if (candidates != 0) {
+                equals_pos = base + __builtin_ctzll(candidates);
+            }
+        }
+    }
+
+    // Handle last field if message doesn't end with delimiter
+    if (field_start < index.length) {
+        emit(index.length);
+    }
+}
+
+/**
+ * Computes the FIX CheckSum of a buffer: the sum of its bytes modulo 256.
+ * For a message, pass every byte up to and including the delimiter before
+ * "10=". Scalar reference implementation.
+ *
+ * @param data Bytes covered by the checksum
+ * @return Sum of the bytes mod 256
+ */
+uint8_t compute_checksum_scalar(std::string_view data);
+
+/**
+ * Computes the FIX CheckSum with SAD-based byte sums on the widest SIMD tier
+ * available. Same result as compute_checksum_scalar().
+ *
+ * Parsers do not need this: build_structural_index() already records the
+ * byte sum of the whole message in StructuralIndex::byte_sum.
+ *
+ * @param data Bytes covered by the checksum
+ * @return Sum of the bytes mod 256
+ */
+uint8_t compute_checksum_simd(std::string_view data);
+
+/**
+ * Longest digit run parse_int() converts with SWAR arithmetic; nine digits
+ * always fit in int32_t. Longer input goes through std::from_chars.
+ */
+constexpr size_t MAX_SWAR_INT_DIGITS = 9;
+
+/**
+ * Longest digit run parse_int64() converts in one vector (AVX-512) or two
+ * SWAR words.
+ */
+constexpr size_t MAX_SIMD_INT_DIGITS = 16;
+
 /**
  * Parses an integer from a string view without copying.
- * More efficient than std::stoi for small integers.
+ * Up to MAX_SWAR_INT_DIGITS digits are converted eight at a time with SWAR
+ * arithmetic; anything else falls back to std::from_chars.
  *
  * @param str String view containing integer
  * @return Parsed integer value
  */
 int32_t parse_int(std::string_view str);
 
+/**
+ * Parses a 64-bit integer (sequence numbers, large quantities). Up to
+ * MAX_SIMD_INT_DIGITS digits are converted by one AVX-512 kernel when the
+ * CPU has it, by two SWAR words otherwise.
+ *
+ * @param str String view containing integer
+ * @return Parsed integer value
+ */
+int64_t parse_int64(std::string_view str);
+
 /**
  * Parses a floating point number from a string view without copying.
  * More efficient than std::stod for typical FIX prices.
@@ -60,4 +420,115 @@ int32_t parse_int(std::string_view str);
  */
 double parse_double(std::string_view str);
 
+/**
+ * Longest digit run parse_decimal() accepts; 10^18 still fits in int64_t.
+ */
+constexpr size_t MAX_DECIMAL_DIGITS = 18;
+
+/**
+ * Parses a FIX price ("-150.25") into an exact decimal without going through
+ * floating point. Digits are converted eight at a time with SWAR arithmetic
+ * on a 64-bit word.
+ *
+ * Accepts an optional '-', at least one integer digit and an optional '.'
+ * followed by at least one digit, MAX_DECIMAL_DIGITS digits in total.
+ *
+ * @param str String view containing the number
+ * @param out Parsed value; unchanged on failure
+ * @return false if str is not a plain decimal number
+ */
+bool parse_decimal(std::string_view str, Decimal64& out);
+
+/**
+ * parse_decimal() for callers that treat malformed numbers as zero, like
+ * parse_double().
+ *
+ * @param str String view containing the number
+ * @return Parsed value, or zero if str is not a plain decimal number
+ */
+Decimal64 parse_decimal(std::string_view str);
+
+/**
+ * Parses a price into the exact decimal FIXMessage stores, converting to
+ * double only when the decimal cannot reproduce the value: exponent
+ * notation, more than 18 digits, or a mantissa of 2^53 and above.
+ *
+ * @param str String view containing the number
+ * @param decimal Exact value, or zero if str is not a plain decimal number
+ * @return 0.0 if decimal.to_double() equals parse_double(str); otherwise
+ *         parse_double(str)
+ */
+double parse_price_fallback(std::string_view str, Decimal64& decimal);
+
+/**
+ * Parses a price once into both representations, each digit run read once.
+ *
+ * @param str String view containing the number
+ * @param decimal Exact value, or zero if str is not a plain decimal number
+ * @return Same value as parse_double(str)
+ */
+double parse_price(std::string_view str, Decimal64& decimal);
+
+/**
+ * Shortest and longest UTCTimestamp parse_timestamp() accepts:
+ * "YYYYMMDD-HH:MM:SS" and the same with nine fraction digits.
+ */
+constexpr size_t MIN_TIMESTAMP_LENGTH = 17;
+constexpr size_t MAX_TIMESTAMP_LENGTH = 27;
+
+/**
+ * Converts a FIX UTCTimestamp ("20261015-13:45:12.123456789") to
+ * nanoseconds since the Unix epoch. One to nine fraction digits are
+ * accepted (milli-, micro- and nanosecond precision are the common ones).
+ * Runs the SSE4.2 kernel when available: the fixed layout is validated with
+ * two compares and the date-time digits are folded with one shuffle and
+ * one multiply-add.
+ *
+ * @param str String view containing the timestamp
+ * @param nanos Nanoseconds since 1970-01-01T00:00:00Z; unchanged on failure
+ * @return false if str is malformed, a field is out of range (e.g. day 31
+ *         in April) or the time is outside the int64_t nanosecond range
+ */
+bool parse_timestamp(std::string_view str, int64_t& nanos);
+
+/**
+ * parse_timestamp() for callers that treat malformed timestamps as zero.
+ *
+ * @param str String view containing the timestamp
+ * @return Nanoseconds since the Unix epoch, or 0 if str is not valid
+ */
+int64_t parse_timestamp(std::string_view str);
+
+/**
+ * Scalar reference implementation of parse_timestamp().
+ */
+bool parse_timestamp_scalar(std::string_view str, int64_t& nanos);
+
+/**
+ * Converts many integers at once: out[i] = parse_int(values[i]).
+ *
+ * With AVX-512, values of up to eight digits are packed one per 64-bit lane
+ * and eight of them are validated and combined per vector; anything else
+ * goes through parse_int(). Collecting values across messages first keeps
+ * the vector units busy where one parse_int() call per field cannot.
+ *
+ * @param values Integer strings
+ * @param out Results; must hold at least values.size() elements
+ */
+void parse_int_batch(std::span<const std::string_view> values, std::span<int32_t> out);
+
+/**
+ * Converts many prices at once: prices[i] = parse_price(values[i], decimals[i]).
+ *
+ * With AVX-512, plain decimals of up to eight digits are combined eight per
+ * vector, and the int -> double conversion and division by the power of ten
+ * also run eight lanes wide. Other values go through parse_price().
+ *
+ * @param values Price strings
+ * @param prices Results as double; must hold at least values.size() elements
+ * @param decimals Exact results; must hold at least values.size() elements
+ */
+void parse_price_batch(std::span<const std::string_view> values, std::span<double> prices,
+                       std::span<Decimal64> decimals);
+
 } // namespace simd_parser
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace simd_parser::swar {
+
+// ----------------------------------------------------------------------------
+// SWAR digit conversion
+//
+// Eight ASCII digits are loaded into a 64-bit word (first digit in the low
+// byte) and combined pairwise: bytes into 2-digit values, those into 4-digit
+// values, then into one 8-digit value -- three multiplies instead of eight.
+// ----------------------------------------------------------------------------
+
+constexpr uint64_t ASCII_ZEROS = 0x3030303030303030ULL;
+
+constexpr std::array<uint64_t, 9> DIGIT_SCALE = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+};
+
+/**
+ * @return true if every byte of the word is an ASCII digit
+ */
+inline bool is_eight_digits(uint64_t chunk) {
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+           0x3333333333333333ULL;
+}
+
+/**
+ * @param chunk Eight ASCII digits, most significant in the low byte
+ * @return Their value, 0..99999999
+ */
+inline uint32_t eight_digits_value(uint64_t chunk) {
+    chunk -= ASCII_ZEROS;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+             (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return static_cast<uint32_t>(chunk);
+}
+
+inline uint64_t load_word(const char* data) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/**
+ * Loads a run of up to eight digits into the high end of a word of '0's, so a
+ * short run converts with the same kernel as a full one. Whole-word loads stay
+ * inside the input; only inputs shorter than a word are assembled byte by byte
+ * (in a register -- byte stores followed by a word load would stall store
+ * forwarding).
+ *
+ * @param input Entire field, bounds every load
+ * @param offset Start of the run in input
+ * @param count Run length, 1..8
+ */
+inline uint64_t load_digits(std::string_view input, size_t offset, size_t count) {
+    const size_t pad_bits = 8 * (8 - count);
+
+    if (input.size() - offset >= 8) {
+        const uint64_t word = load_word(input.data() + offset) << pad_bits;
+        return count == 8 ? word : word | (ASCII_ZEROS >> (64 - pad_bits));
+    }
+    if (offset + count >= 8) {
+        const uint64_t keep = ~uint64_t{0} << pad_bits;
+        return (load_word(input.data() + offset + count - 8) & keep) | (ASCII_ZEROS & ~keep);
+    }
+
+    uint64_t chunk = ASCII_ZEROS;
+    for (size_t i = 0; i < count; ++i) {
+        chunk = (chunk >> 8) | (static_cast<uint64_t>(static_cast<uint8_t>(input[offset + i])) << 56);
+    }
+    return chunk;
+}
+
+/**
+ * Appends a run of digits to value, the leading partial chunk first. The
+ * caller bounds the run length so value cannot overflow.
+ *
+ * @param input Entire field
+ * @param offset Start of the run in input
+ * @param count Run length
+ * @param value Accumulated value
+ * @return false if the run contains a non-digit
+ */
+inline bool accumulate_digits(std::string_view input, size_t offset, size_t count, uint64_t& value) {
+    while (count > 0) {
+        const size_t take = count % 8 != 0 ? count % 8 : 8;
+        const uint64_t chunk = load_digits(input, offset, take);
+        if (!is_eight_digits(chunk)) {
+            return false;
+        }
+        value = value * DIGIT_SCALE[take] + eight_digits_value(chunk);
+        offset += take;
+        count -= take;
+    }
+    return true;
+}
+
+} // namespace simd_parser::swar
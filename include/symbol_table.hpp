@@ -0,0 +1,99 @@
+#pragma once
+
+#include "fix_message.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace simd_parser {
+
+namespace detail {
+
+/**
+ * Eight table entries: the keys fill exactly one cache line, so a probe
+ * compares all of them with one 512-bit (or two 256-bit) compares.
+ */
+struct alignas(64) SymbolGroup {
+    static constexpr size_t WIDTH = 8;
+
+    uint64_t keys[WIDTH] = {};  // 0 marks an empty entry
+    uint32_t ids[WIDTH] = {};
+};
+
+} // namespace detail
+
+/**
+ * Interns instrument symbols into dense ids 0, 1, 2, ... in order of first
+ * appearance, so per-instrument state can live in plain arrays indexed by
+ * FIXMessage::symbol_id instead of hash maps keyed by the symbol string.
+ *
+ * Symbols of up to eight bytes (nearly all equity and futures tickers) are
+ * packed into a uint64_t that is its own key: a lookup is a multiply for the
+ * home group and one vector compare of eight keys, with no string compare.
+ * Longer symbols are keyed by a hash and confirmed against the stored name.
+ * The table is open-addressed by 8-entry group and never holds more than
+ * 7/8 of its capacity.
+ *
+ * Attach a table to a ParserContext to have the parsers fill symbol_id:
+ *
+ *   SymbolTable symbols;
+ *   ParserContext context;
+ *   context.symbols = &symbols;
+ *   FIXMessage msg = parse_simd(raw, context);  // msg.symbol_id is dense
+ *
+ * intern() modifies the table, so a table must not be shared by contexts on
+ * different threads; find() and name() on a table nobody is interning into
+ * are safe from any thread.
+ */
+class SymbolTable {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    /**
+     * @param expected_symbols Symbols to make room for before the first rehash
+     */
+    explicit SymbolTable(size_t expected_symbols = DEFAULT_CAPACITY);
+
+    /**
+     * Returns the id of a symbol, assigning the next id if it is new.
+     *
+     * @param symbol Symbol bytes; copied on first sight
+     * @return Dense id, or NO_SYMBOL_ID for an empty symbol
+     */
+    uint32_t intern(std::string_view symbol);
+
+    /**
+     * Looks up a symbol without inserting it.
+     *
+     * @param symbol Symbol bytes
+     * @return Its id, or NO_SYMBOL_ID if it has not been interned
+     */
+    uint32_t find(std::string_view symbol) const;
+
+    /**
+     * @param id Id returned by intern()
+     * @return The symbol; the view stays valid for the table's lifetime
+     */
+    std::string_view name(uint32_t id) const { return names_[id]; }
+
+    /**
+     * @return Number of interned symbols; ids are 0 .. size() - 1
+     */
+    size_t size() const { return names_.size(); }
+
+    /**
+     * @return Entries the table can hold, including the free eighth
+     */
+    size_t capacity() const { return groups_.size() * detail::SymbolGroup::WIDTH; }
+
+private:
+    void rehash(size_t group_count);
+
+    std::vector<detail::SymbolGroup> groups_;
+    std::deque<std::string> names_;  // Indexed by id; deque keeps name() views stable
+};
+
+} // namespace simd_parser
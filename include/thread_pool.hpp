@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace simd_parser {
+
+/**
+ * Fixed set of worker threads that run indexed tasks with work stealing.
+ *
+ * run(count, task) splits task indices 0..count-1 into one contiguous range
+ * per worker. A worker takes tasks from the front of its own range, in
+ * order, so neighbouring tasks (usually neighbouring data) stay on one core.
+ * A worker whose range is empty steals the back half of another worker's
+ * range. Each range is a single 64-bit atomic (begin, end) updated by CAS,
+ * so neither taking nor stealing a task locks anything. Idle workers sleep
+ * in atomic wait() on a run generation counter rather than on a mutex.
+ *
+ * Tasks must not throw. run() is not reentrant and must not be called from
+ * two threads at once.
+ */
+class ThreadPool {
+public:
+    /**
+     * Called once per task index; `worker` (0 .. size() - 1) identifies the
+     * thread, e.g. to pick per-thread scratch space.
+     */
+    using Task = std::function<void(size_t task, size_t worker)>;
+
+    /**
+     * Per-worker counts for the last run().
+     */
+    struct alignas(64) WorkerCounters {
+        size_t tasks = 0;   // Tasks this worker ran
+        size_t steals = 0;  // Successful steals from other workers
+    };
+
+    /**
+     * @param threads Worker count; 0 means std::thread::hardware_concurrency()
+     */
+    explicit ThreadPool(size_t threads = 0);
+
+    /**
+     * Joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Runs task(i, worker) for every i in 0 .. task_count - 1 and returns
+     * once all of them have finished. Their writes are visible to the
+     * caller afterwards.
+     *
+     * @param task_count Number of tasks, below 2^32
+     * @param task Task body
+     */
+    void run(size_t task_count, const Task& task);
+
+    size_t size() const { return threads_.size(); }
+
+    /**
+     * @return One entry per worker, for the last run()
+     */
+    const std::vector<WorkerCounters>& counters() const { return counters_; }
+
+private:
+    // Remaining task indices of one worker: begin in the low half, end in
+    // the high half of one word, so both move together in one CAS
+    struct alignas(64) TaskRange {
+        std::atomic<uint64_t> bounds{0};
+    };
+
+    void worker_loop(size_t worker);
+    bool take_own(size_t worker, size_t& task);
+    bool steal(size_t thief, size_t& task);
+
+    std::vector<std::thread> threads_;
+    std::unique_ptr<TaskRange[]> ranges_;
+    std::vector<WorkerCounters> counters_;
+
+    const Task* task_ = nullptr;              // Published by generation_
+    std::atomic<uint64_t> generation_{0};     // Bumped to start a run or stop
+    std::atomic<size_t> running_{0};          // Workers still in the current run
+    std::atomic<bool> stopping_{false};
+};
+
+} // namespace simd_parser
@@ -0,0 +1,226 @@
+#include "field_batch.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <immintrin.h>
+
+namespace simd_parser {
+
+namespace {
+
+// "<delim>" + up to ten tag digits + "="
+constexpr size_t MAX_PATTERN = 12;
+
+// Messages located per parse_price_batch() call
+constexpr size_t PRICE_CHUNK = 64;
+
+struct TagPattern {
+    char bytes[MAX_PATTERN] = {};
+    size_t size = 0;
+};
+
+using FieldKernel = void (*)(const std::string_view* messages, size_t count, const TagPattern& pattern,
+                             std::string_view* values);
+
+TagPattern make_pattern(char delimiter, uint32_t tag) {
+    char digits[10];
+    size_t count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + tag % 10);
+        tag /= 10;
+    } while (tag != 0);
+
+    TagPattern pattern;
+    pattern.bytes[pattern.size++] = delimiter;
+    while (count > 0) {
+        pattern.bytes[pattern.size++] = digits[--count];
+    }
+    pattern.bytes[pattern.size++] = '=';
+    return pattern;
+}
+
+/**
+ * Value starting at `start`, up to the next delimiter or the end.
+ */
+std::string_view value_at(const char* data, size_t size, size_t start, char delimiter) {
+    const void* end = std::memchr(data + start, delimiter, size - start);
+    const size_t stop = end ? static_cast<size_t>(static_cast<const char*>(end) - data) : size;
+    return std::string_view(data + start, stop - start);
+}
+
+/**
+ * A message that opens with the tag has no delimiter in front of it.
+ */
+bool leading_value(std::string_view message, const TagPattern& pattern, std::string_view& value) {
+    const std::string_view tag(pattern.bytes + 1, pattern.size - 1);
+    if (!message.starts_with(tag)) {
+        return false;
+    }
+    value = value_at(message.data(), message.size(), tag.size(), pattern.bytes[0]);
+    return true;
+}
+
+void extract_scalar(const std::string_view* messages, size_t count, const TagPattern& pattern,
+                    std::string_view* values) {
+    const std::string_view needle(pattern.bytes, pattern.size);
+    for (size_t i = 0; i < count; ++i) {
+        const std::string_view message = messages[i];
+        if (leading_value(message, pattern, values[i])) {
+            continue;
+        }
+        const size_t pos = message.find(needle);
+        values[i] = pos == std::string_view::npos
+                        ? std::string_view()
+                        : value_at(message.data(), message.size(), pos + needle.size(), pattern.bytes[0]);
+    }
+}
+
+__attribute__((target("avx2")))
+void extract_avx2(const std::string_view* messages, size_t count, const TagPattern& pattern,
+                  std::string_view* values) {
+    const size_t length = pattern.size;
+    __m256i needles[MAX_PATTERN];
+    for (size_t k = 0; k < length; ++k) {
+        needles[k] = _mm256_set1_epi8(pattern.bytes[k]);
+    }
+    // Blocks overlap by length - 1 bytes so no pattern straddles two of them
+    const size_t step = 32 - (length - 1);
+
+    for (size_t i = 0; i < count; ++i) {
+        const char* data = messages[i].data();
+        const size_t size = messages[i].size();
+        values[i] = {};
+        if (leading_value(messages[i], pattern, values[i]) || size < length) {
+            continue;
+        }
+        for (size_t pos = 0;; pos += step) {
+            const size_t left = size - pos;
+            __m256i block;
+            if (left >= 32) {
+                block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+            } else {
+                // Zero padding never matches a pattern byte or the delimiter
+                alignas(32) char tail[32] = {};
+                std::memcpy(tail, data + pos, left);
+                block = _mm256_load_si256(reinterpret_cast<const __m256i*>(tail));
+            }
+            const uint32_t delimiters =
+                static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needles[0])));
+            uint32_t match = delimiters;
+            for (size_t k = 1; k < length; ++k) {
+                match &= static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needles[k]))) >> k;
+            }
+            if (match != 0) {
+                const size_t start = static_cast<size_t>(__builtin_ctz(match)) + length;
+                const uint32_t after = start < 32 ? delimiters >> start : 0;
+                if (after != 0) {
+                    values[i] = std::string_view(data + pos + start, static_cast<size_t>(__builtin_ctz(after)));
+                } else {
+                    values[i] = value_at(data, size, pos + start, pattern.bytes[0]);
+                }
+                break;
+            }
+            if (left <= 32) {
+                break;
+            }
+        }
+    }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void extract_avx512(const std::string_view* messages, size_t count, const TagPattern& pattern,
+                    std::string_view* values) {
+    const size_t length = pattern.size;
+    __m512i needles[MAX_PATTERN];
+    for (size_t k = 0; k < length; ++k) {
+        needles[k] = _mm512_set1_epi8(pattern.bytes[k]);
+    }
+    // Blocks overlap by length - 1 bytes so no pattern straddles two of them
+    const size_t step = 64 - (length - 1);
+
+    for (size_t i = 0; i < count; ++i) {
+        const char* data = messages[i].data();
+        const size_t size = messages[i].size();
+        values[i] = {};
+        if (leading_value(messages[i], pattern, values[i]) || size < length) {
+            continue;
+        }
+        // A message of up to 64 bytes is a single iteration
+        for (size_t pos = 0;; pos += step) {
+            const size_t left = size - pos;
+            const __mmask64 in_bounds = left >= 64 ? ~__mmask64(0) : (__mmask64(1) << left) - 1;
+            const __m512i block = _mm512_maskz_loadu_epi8(in_bounds, data + pos);
+            const __mmask64 delimiters = _mm512_cmpeq_epi8_mask(block, needles[0]);
+            __mmask64 match = delimiters;
+            for (size_t k = 1; k < length; ++k) {
+                match &= _mm512_cmpeq_epi8_mask(block, needles[k]) >> k;
+            }
+            if (match != 0) {
+                const size_t start = static_cast<size_t>(__builtin_ctzll(match)) + length;
+                const __mmask64 after = start < 64 ? delimiters >> start : 0;
+                if (after != 0) {
+                    values[i] = std::string_view(data + pos + start, static_cast<size_t>(__builtin_ctzll(after)));
+                } else {
+                    values[i] = value_at(data, size, pos + start, pattern.bytes[0]);
+                }
+                break;
+            }
+            if (left <= 64) {
+                break;
+            }
+        }
+    }
+}
+
+FieldKernel select_field_kernel(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return extract_avx512;
+        case SimdLevel::AVX2:
+            return extract_avx2;
+        case SimdLevel::SSE42:
+        case SimdLevel::Scalar:
+            break;
+    }
+    return extract_scalar;
+}
+
+} // anonymous namespace
+
+template <char Delimiter>
+void extract_field_batch(std::span<const std::string_view> messages, uint32_t tag,
+                         std::span<std::string_view> values) {
+    static const FieldKernel extract = select_field_kernel(cpu_features().best_level());
+    extract(messages.data(), messages.size(), make_pattern(Delimiter, tag), values.data());
+}
+
+template <char Delimiter>
+void extract_field_batch(std::span<const std::string_view> messages, uint32_t tag,
+                         std::span<std::string_view> values, SimdLevel level) {
+    select_field_kernel(level)(messages.data(), messages.size(), make_pattern(Delimiter, tag), values.data());
+}
+
+template <char Delimiter>
+void extract_price_batch(std::span<const std::string_view> messages, std::span<double> prices,
+                         std::span<Decimal64> decimals) {
+    std::array<std::string_view, PRICE_CHUNK> values;
+    for (size_t done = 0; done < messages.size(); done += PRICE_CHUNK) {
+        const size_t count = std::min(PRICE_CHUNK, messages.size() - done);
+        extract_field_batch<Delimiter>(messages.subspan(done, count), static_cast<uint32_t>(FIXTag::Price),
+                                       std::span<std::string_view>(values.data(), count));
+        parse_price_batch(std::span<const std::string_view>(values.data(), count), prices.subspan(done, count),
+                          decimals.subspan(done, count));
+    }
+}
+
+template void extract_field_batch<'|'>(std::span<const std::string_view>, uint32_t, std::span<std::string_view>);
+template void extract_field_batch<SOH>(std::span<const std::string_view>, uint32_t, std::span<std::string_view>);
+template void extract_field_batch<'|'>(std::span<const std::string_view>, uint32_t, std::span<std::string_view>,
+                                       SimdLevel);
+template void extract_field_batch<SOH>(std::span<const std::string_view>, uint32_t, std::span<std::string_view>,
+                                       SimdLevel);
+template void extract_price_batch<'|'>(std::span<const std::string_view>, std::span<double>, std::span<Decimal64>);
+template void extract_price_batch<SOH>(std::span<const std::string_view>, std::span<double>, std::span<Decimal64>);
+
+} // namespace simd_parser
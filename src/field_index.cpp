@@ -0,0 +1,73 @@
+#include "field_index.hpp"
+
+namespace simd_parser {
+
+FieldIndex::FieldIndex(size_t max_fields)
+    : large_tags_(MIN_LARGE_TAG_SLOTS),
+      large_tag_shift_(64 - __builtin_ctzll(MIN_LARGE_TAG_SLOTS)) {
+    fields_.reserve(max_fields);
+    large_used_.reserve(MIN_LARGE_TAG_SLOTS / 2);
+}
+
+void FieldIndex::reset(std::string_view message) {
+    for (const Field& field : fields_) {
+        if (field.tag < TAG_TABLE_SIZE) {
+            first_[field.tag] = 0;
+        }
+    }
+    for (uint32_t slot : large_used_) {
+        large_tags_[slot] = LargeTagSlot();
+    }
+    large_used_.clear();
+    fields_.clear();
+    message_ = message;
+}
+
+void FieldIndex::add_large_tag(uint32_t tag, uint32_t position) {
+    if ((large_used_.size() + 1) * 2 > large_tags_.size()) {
+        grow_large_tags();
+    }
+    const size_t mask = large_tags_.size() - 1;
+    for (size_t slot = large_tag_home(tag);; slot = (slot + 1) & mask) {
+        LargeTagSlot& entry = large_tags_[slot];
+        if (entry.entry == 0) {
+            entry = {tag, position + 1};
+            large_used_.push_back(static_cast<uint32_t>(slot));
+            return;
+        }
+        if (entry.tag == tag) {
+            return;  // Repeated tag: the first occurrence stays
+        }
+    }
+}
+
+void FieldIndex::grow_large_tags() {
+    std::vector<LargeTagSlot> filled;
+    filled.reserve(large_used_.size());
+    for (uint32_t slot : large_used_) {
+        filled.push_back(large_tags_[slot]);
+    }
+
+    large_tags_.assign(large_tags_.size() * 2, LargeTagSlot());
+    --large_tag_shift_;
+    large_used_.clear();
+    // Reinserting in fill order keeps each tag's first occurrence
+    for (const LargeTagSlot& entry : filled) {
+        add_large_tag(entry.tag, entry.entry - 1);
+    }
+}
+
+std::string_view FieldIndex::find_large_tag(uint32_t tag) const {
+    const size_t mask = large_tags_.size() - 1;
+    for (size_t slot = large_tag_home(tag);; slot = (slot + 1) & mask) {
+        const LargeTagSlot& entry = large_tags_[slot];
+        if (entry.entry == 0) {
+            return std::string_view();
+        }
+        if (entry.tag == tag) {
+            return value(fields_[entry.entry - 1]);
+        }
+    }
+}
+
+} // namespace simd_parser
@@ -0,0 +1,280 @@
+#include "framer.hpp"
+#include "simd_utils.hpp"
+#include <algorithm>
+
+namespace simd_parser {
+
+namespace {
+
+constexpr size_t BLOCK_SIZE = 64;
+constexpr size_t CHUNK_BLOCKS = 16;
+constexpr size_t CHUNK_SIZE = CHUNK_BLOCKS * BLOCK_SIZE;
+constexpr size_t NO_MESSAGE = static_cast<size_t>(-1);
+
+// BeginString of every FIX version ("8=FIX.4.4", "8=FIXT.1.1")
+constexpr std::string_view BEGIN_STRING = "8=FIX";
+
+/**
+ * Message boundary bookkeeping shared by the candidate handlers.
+ */
+struct FrameState {
+    std::string_view buffer;
+    std::span<std::string_view> out;
+    size_t count = 0;
+    size_t open = NO_MESSAGE;  // Start of the message currently being framed
+    size_t frame_end = 0;      // End of the last emitted message
+
+    bool full() const { return count == out.size(); }
+
+    void emit(size_t start, size_t end) {
+        out[count++] = buffer.substr(start, end - start);
+        frame_end = end;
+    }
+};
+
+/**
+ * Handles a "<delim>8=" candidate: a verified BeginString closes the open
+ * message (if it had no trailer) and opens a new one.
+ */
+void on_begin_candidate(FrameState& state, size_t pos) {
+    if (state.buffer.substr(pos, BEGIN_STRING.size()) != BEGIN_STRING) {
+        return;
+    }
+    if (state.open != NO_MESSAGE) {
+        state.emit(state.open, pos);
+        if (state.full()) {
+            state.open = NO_MESSAGE;
+            return;
+        }
+    }
+    state.open = pos;
+}
+
+/**
+ * Handles a "<delim>1?=" candidate: a verified "10=" trailer closes the open
+ * message once the delimiter after the checksum value has arrived.
+ */
+template <char Delimiter>
+void on_trailer_candidate(FrameState& state, size_t pos) {
+    if (state.open == NO_MESSAGE || state.buffer[pos + 1] != '0') {
+        return;
+    }
+    size_t end = state.buffer.find(Delimiter, pos + 3);
+    if (end == std::string_view::npos) {
+        return;  // Checksum value still in flight
+    }
+    state.emit(state.open, end + 1);
+    state.open = NO_MESSAGE;
+}
+
+// Header fields are short; anything longer is not a FIX header
+constexpr size_t MAX_BEGIN_STRING_FIELD = 32;
+constexpr size_t MAX_BODY_LENGTH_DIGITS = 9;
+
+/**
+ * Returns the offset to resume length-driven framing from after malformed
+ * input at `offset`: just past the delimiter of the next "<delim>8=FIX".
+ */
+template <char Delimiter>
+size_t resynchronise(std::string_view buffer, size_t offset) {
+    static constexpr char pattern[] = {Delimiter, '8', '=', 'F', 'I', 'X'};
+    constexpr std::string_view begin_pattern(pattern, sizeof(pattern));
+
+    size_t pos = buffer.find(begin_pattern, offset);
+    if (pos != std::string_view::npos) {
+        return pos + 1;
+    }
+    // Keep enough bytes to recognise a pattern split across reads
+    const size_t keep = begin_pattern.size() - 1;
+    return std::max(offset + 1, buffer.size() > keep ? buffer.size() - keep : 0);
+}
+
+} // anonymous namespace
+
+template <char Delimiter>
+FrameResult frame_messages(std::string_view buffer, std::span<std::string_view> out,
+                           bool end_of_stream) {
+    FrameState state{buffer, out};
+    const size_t size = buffer.size();
+
+    uint64_t delimiter_masks[CHUNK_BLOCKS];
+    uint64_t eight_masks[CHUNK_BLOCKS];
+    uint64_t one_masks[CHUNK_BLOCKS];
+    uint64_t equals_masks[CHUNK_BLOCKS + 1];  // One block of lookahead
+
+    // The start of the buffer counts as "after a delimiter"
+    uint64_t carry = 1;
+
+    for (size_t chunk = 0; chunk < size && !state.full(); chunk += CHUNK_SIZE) {
+        const size_t chunk_size = std::min(CHUNK_SIZE, size - chunk);
+        const size_t blocks = (chunk_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        std::string_view bytes = buffer.substr(chunk, chunk_size);
+
+        build_match_masks(bytes, Delimiter, delimiter_masks);
+        build_match_masks(bytes, '8', eight_masks);
+        build_match_masks(bytes, '1', one_masks);
+        std::fill(std::begin(equals_masks), std::end(equals_masks), 0);
+        build_match_masks(buffer.substr(chunk, chunk_size + BLOCK_SIZE), '=', equals_masks);
+
+        for (size_t block = 0; block < blocks && !state.full(); ++block) {
+            const uint64_t after_delimiter = (delimiter_masks[block] << 1) | carry;
+            carry = delimiter_masks[block] >> 63;
+
+            // '=' one and two bytes ahead, pulling bits in from the next block
+            const uint64_t equals = equals_masks[block];
+            const uint64_t next_equals = equals_masks[block + 1];
+            const uint64_t equals_at_1 = (equals >> 1) | (next_equals << 63);
+            const uint64_t equals_at_2 = (equals >> 2) | (next_equals << 62);
+
+            const uint64_t begins = after_delimiter & eight_masks[block] & equals_at_1;
+            const uint64_t trailers = after_delimiter & one_masks[block] & equals_at_2;
+
+            uint64_t candidates = begins | trailers;
+            const size_t base = chunk + block * BLOCK_SIZE;
+            while (candidates != 0 && !state.full()) {
+                const unsigned bit = static_cast<unsigned>(__builtin_ctzll(candidates));
+                candidates &= candidates - 1;
+                if ((begins >> bit) & 1) {
+                    on_begin_candidate(state, base + bit);
+                } else {
+                    on_trailer_candidate<Delimiter>(state, base + bit);
+                }
+            }
+        }
+    }
+
+    FrameResult result;
+    if (state.open != NO_MESSAGE) {
+        if (end_of_stream) {
+            state.emit(state.open, size);
+            result.consumed = size;
+        } else {
+            // Hold the incomplete message back for the next read
+            result.consumed = state.open;
+        }
+    } else if (state.full()) {
+        result.consumed = state.frame_end;
+    } else if (end_of_stream) {
+        result.consumed = size;
+    } else {
+        // Keep enough trailing bytes to recognise a BeginString split across reads
+        const size_t keep = std::min(size, BEGIN_STRING.size() - 1);
+        result.consumed = std::max(state.frame_end, size - keep);
+    }
+    result.message_count = state.count;
+    return result;
+}
+
+template <char Delimiter>
+FrameStatus locate_body(std::string_view buffer, BodyLocation& location) {
+    // BeginString: "8=" up to the first delimiter
+    if (buffer.size() < 2) {
+        return std::string_view("8=").starts_with(buffer) ? FrameStatus::Incomplete
+                                                          : FrameStatus::Malformed;
+    }
+    if (buffer[0] != '8' || buffer[1] != '=') {
+        return FrameStatus::Malformed;
+    }
+    const size_t begin_end = buffer.substr(0, MAX_BEGIN_STRING_FIELD).find(Delimiter);
+    if (begin_end == std::string_view::npos) {
+        return buffer.size() < MAX_BEGIN_STRING_FIELD ? FrameStatus::Incomplete
+                                                      : FrameStatus::Malformed;
+    }
+
+    // BodyLength: "9=" and up to MAX_BODY_LENGTH_DIGITS digits
+    size_t pos = begin_end + 1;
+    if (pos + 2 > buffer.size()) {
+        return std::string_view("9=").starts_with(buffer.substr(pos)) ? FrameStatus::Incomplete
+                                                                      : FrameStatus::Malformed;
+    }
+    if (buffer[pos] != '9' || buffer[pos + 1] != '=') {
+        return FrameStatus::Malformed;
+    }
+    pos += 2;
+
+    size_t body_length = 0;
+    size_t digits = 0;
+    for (; pos < buffer.size() && buffer[pos] != Delimiter; ++pos, ++digits) {
+        const char c = buffer[pos];
+        if (c < '0' || c > '9' || digits == MAX_BODY_LENGTH_DIGITS) {
+            return FrameStatus::Malformed;
+        }
+        body_length = body_length * 10 + static_cast<size_t>(c - '0');
+    }
+    if (pos == buffer.size()) {
+        return FrameStatus::Incomplete;
+    }
+    if (digits == 0) {
+        return FrameStatus::Malformed;
+    }
+
+    location.body_start = pos + 1;
+    location.body_length = body_length;
+    return FrameStatus::Complete;
+}
+
+template <char Delimiter>
+FrameStatus message_extent(std::string_view buffer, size_t& length) {
+    length = 0;
+
+    BodyLocation location;
+    FrameStatus status = locate_body<Delimiter>(buffer, location);
+    if (status != FrameStatus::Complete) {
+        return status;
+    }
+
+    // The body ends with a delimiter and the trailer follows immediately;
+    // check whatever part of it has arrived
+    const size_t trailer = location.body_end();
+    if (trailer <= buffer.size() && buffer[trailer - 1] != Delimiter) {
+        return FrameStatus::Malformed;
+    }
+    std::string_view arrived = buffer.substr(std::min(trailer, buffer.size()), CHECKSUM_FIELD_SIZE);
+    for (size_t i = 0; i < arrived.size(); ++i) {
+        const char c = arrived[i];
+        const bool ok = i < 3 ? c == "10="[i]
+                      : i < 6 ? (c >= '0' && c <= '9')
+                              : c == Delimiter;
+        if (!ok) {
+            return FrameStatus::Malformed;
+        }
+    }
+
+    length = trailer + CHECKSUM_FIELD_SIZE;
+    return length <= buffer.size() ? FrameStatus::Complete : FrameStatus::Incomplete;
+}
+
+template <char Delimiter>
+FrameResult frame_messages_by_length(std::string_view buffer, std::span<std::string_view> out) {
+    FrameResult result;
+    size_t offset = 0;
+
+    while (offset < buffer.size() && result.message_count < out.size()) {
+        size_t length = 0;
+        FrameStatus status = message_extent<Delimiter>(buffer.substr(offset), length);
+
+        if (status == FrameStatus::Complete) {
+            out[result.message_count++] = buffer.substr(offset, length);
+            offset += length;
+        } else if (status == FrameStatus::Incomplete) {
+            result.bytes_needed = length;
+            break;
+        } else {
+            offset = resynchronise<Delimiter>(buffer, offset);
+        }
+    }
+
+    result.consumed = offset;
+    return result;
+}
+
+template FrameResult frame_messages<'|'>(std::string_view, std::span<std::string_view>, bool);
+template FrameResult frame_messages<SOH>(std::string_view, std::span<std::string_view>, bool);
+template FrameStatus locate_body<'|'>(std::string_view, BodyLocation&);
+template FrameStatus locate_body<SOH>(std::string_view, BodyLocation&);
+template FrameStatus message_extent<'|'>(std::string_view, size_t&);
+template FrameStatus message_extent<SOH>(std::string_view, size_t&);
+template FrameResult frame_messages_by_length<'|'>(std::string_view, std::span<std::string_view>);
+template FrameResult frame_messages_by_length<SOH>(std::string_view, std::span<std::string_view>);
+
+} // namespace simd_parser
@@ -0,0 +1,35 @@
+#include "lazy_message.hpp"
+
+namespace simd_parser {
+
+double LazyFIXMessage::price() const {
+    if (!is_decoded(FieldSlot::Price)) {
+        price_ = parse_price(field(FieldSlot::Price), price_decimal_);
+        decoded_ |= slot_bit(FieldSlot::Price);
+    }
+    return price_;
+}
+
+Decimal64 LazyFIXMessage::price_decimal() const {
+    price();
+    return price_decimal_;
+}
+
+FIXMessage LazyFIXMessage::to_message() const {
+    FIXMessage msg;
+    msg.message_type = message_type();
+    msg.symbol = symbol();
+    msg.sender = sender();
+    msg.target = target();
+    msg.side = side();
+    msg.price_fallback = parse_price_fallback(field(FieldSlot::Price), msg.price_decimal);
+    msg.quantity = quantity();
+    msg.body_length = body_length();
+    msg.sending_time = sending_time();
+    msg.transact_time = transact_time();
+    msg.valid = valid();
+    msg.checksum_valid = checksum_valid();
+    return msg;
+}
+
+} // namespace simd_parser
@@ -0,0 +1,42 @@
+#include "market_data.hpp"
+
+namespace simd_parser {
+
+MarketDataEntries::MarketDataEntries(size_t max_entries) {
+    const size_t capacity = max_entries + COLUMN_PADDING;
+    actions.reserve(capacity);
+    entry_types.reserve(capacity);
+    prices.reserve(capacity);
+    sizes.reserve(capacity);
+    symbols.reserve(capacity);
+}
+
+void MarketDataEntries::clear() {
+    actions.clear();
+    entry_types.clear();
+    prices.clear();
+    sizes.clear();
+    symbols.clear();
+    declared_count = 0;
+    count_ = 0;
+}
+
+void MarketDataEntries::add_entry() {
+    actions.push_back(0);
+    entry_types.push_back('\0');
+    prices.push_back(0.0);
+    sizes.push_back(0.0);
+    symbols.emplace_back();
+    ++count_;
+}
+
+void MarketDataEntries::pad() {
+    const size_t padded = padded_size();
+    actions.resize(padded, 0);
+    entry_types.resize(padded, '\0');
+    prices.resize(padded, 0.0);
+    sizes.resize(padded, 0.0);
+    symbols.resize(padded);
+}
+
+} // namespace simd_parser
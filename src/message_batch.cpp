@@ -0,0 +1,68 @@
+#include "message_batch.hpp"
+
+namespace simd_parser {
+
+MessageBatch::MessageBatch(size_t max_messages) {
+    const size_t capacity = max_messages + COLUMN_PADDING;
+    offsets.reserve(capacity);
+    lengths.reserve(capacity);
+    msg_types.reserve(capacity);
+    symbol_offsets.reserve(capacity);
+    symbol_lengths.reserve(capacity);
+    symbol_ids.reserve(capacity);
+    sides.reserve(capacity);
+    prices.reserve(capacity);
+    quantities.reserve(capacity);
+    valid.reserve(capacity);
+    checksum_valid.reserve(capacity);
+}
+
+void MessageBatch::reset(std::string_view source) {
+    buffer = source;
+    offsets.clear();
+    lengths.clear();
+    msg_types.clear();
+    symbol_offsets.clear();
+    symbol_lengths.clear();
+    symbol_ids.clear();
+    sides.clear();
+    prices.clear();
+    quantities.clear();
+    valid.clear();
+    checksum_valid.clear();
+    count_ = 0;
+}
+
+size_t MessageBatch::append(size_t count) {
+    const size_t first = count_;
+    count_ += count;
+    offsets.resize(count_, 0);
+    lengths.resize(count_, 0);
+    msg_types.resize(count_, 0);
+    symbol_offsets.resize(count_, 0);
+    symbol_lengths.resize(count_, 0);
+    symbol_ids.resize(count_, NO_SYMBOL_ID);
+    sides.resize(count_, 0);
+    prices.resize(count_, 0.0);
+    quantities.resize(count_, 0);
+    valid.resize(count_, 0);
+    checksum_valid.resize(count_, 0);
+    return first;
+}
+
+void MessageBatch::pad() {
+    const size_t padded = padded_size();
+    offsets.resize(padded, 0);
+    lengths.resize(padded, 0);
+    msg_types.resize(padded, 0);
+    symbol_offsets.resize(padded, 0);
+    symbol_lengths.resize(padded, 0);
+    symbol_ids.resize(padded, NO_SYMBOL_ID);
+    sides.resize(padded, 0);
+    prices.resize(padded, 0.0);
+    quantities.resize(padded, 0);
+    valid.resize(padded, 0);
+    checksum_valid.resize(padded, 0);
+}
+
+} // namespace simd_parser
@@ -0,0 +1,179 @@
+#include "parallel_parser.hpp"
+#include "framer.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+
+namespace simd_parser {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+size_t total_bytes(std::span<const std::string_view> messages) {
+    size_t bytes = 0;
+    for (std::string_view message : messages) {
+        bytes += message.size();
+    }
+    return bytes;
+}
+
+// Messages framed per frame_messages() call inside a parse_buffer() chunk
+constexpr size_t FRAME_BATCH = 4 * BATCH_CONVERT_SIZE;
+
+} // anonymous namespace
+
+size_t ParallelParseStats::messages() const {
+    size_t total = 0;
+    for (const ParseWorkerStats& worker : workers) {
+        total += worker.messages;
+    }
+    return total;
+}
+
+size_t ParallelParseStats::bytes() const {
+    size_t total = 0;
+    for (const ParseWorkerStats& worker : workers) {
+        total += worker.bytes;
+    }
+    return total;
+}
+
+std::string ParallelParseStats::report() const {
+    std::string text = "worker   messages    M msg/s       MB/s   chunks   steals\n";
+    char line[96];
+    for (size_t i = 0; i < workers.size(); ++i) {
+        const ParseWorkerStats& worker = workers[i];
+        std::snprintf(line, sizeof(line), "%6zu %10zu %10.2f %10.1f %8zu %8zu\n", i, worker.messages,
+                      worker.messages_per_second() / 1e6, worker.bytes_per_second() / 1e6,
+                      worker.tasks, worker.steals);
+        text += line;
+    }
+    const double wall = wall_seconds > 0 ? wall_seconds : 1.0;
+    std::snprintf(line, sizeof(line), " total %10zu %10.2f %10.1f   (wall %.3f ms)\n", messages(),
+                  messages() / wall / 1e6, bytes() / wall / 1e6, wall_seconds * 1e3);
+    text += line;
+    return text;
+}
+
+ParallelParser::ParallelParser(size_t threads) : pool_(threads), workers_(pool_.size()) {}
+
+void ParallelParser::reset_stats() {
+    for (WorkerState& worker : workers_) {
+        worker.stats = ParseWorkerStats();
+    }
+}
+
+ParallelParseStats ParallelParser::collect_stats(double wall_seconds) const {
+    ParallelParseStats stats;
+    stats.wall_seconds = wall_seconds;
+    stats.workers.reserve(workers_.size());
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        ParseWorkerStats worker = workers_[i].stats;
+        worker.tasks = pool_.counters()[i].tasks;
+        worker.steals = pool_.counters()[i].steals;
+        stats.workers.push_back(worker);
+    }
+    return stats;
+}
+
+template <char Delimiter>
+ParallelParseStats ParallelParser::parse(std::span<const std::string_view> messages,
+                                         std::span<FIXMessage> out) {
+    const Clock::time_point start = Clock::now();
+    reset_stats();
+
+    const size_t chunks = (messages.size() + CHUNK_MESSAGES - 1) / CHUNK_MESSAGES;
+    pool_.run(chunks, [&](size_t chunk, size_t worker) {
+        const Clock::time_point chunk_start = Clock::now();
+        const size_t first = chunk * CHUNK_MESSAGES;
+        const size_t count = std::min(CHUNK_MESSAGES, messages.size() - first);
+        WorkerState& state = workers_[worker];
+
+        parse_simd_batch<Delimiter>(messages.subspan(first, count), state.context, out.subspan(first, count));
+
+        state.stats.messages += count;
+        state.stats.bytes += total_bytes(messages.subspan(first, count));
+        state.stats.busy_seconds += seconds_since(chunk_start);
+    });
+
+    return collect_stats(seconds_since(start));
+}
+
+template <char Delimiter>
+ParallelParseStats ParallelParser::parse_buffer(std::string_view buffer, std::vector<FIXMessage>& out) {
+    const Clock::time_point start = Clock::now();
+    reset_stats();
+
+    // Cut about every CHUNK_BYTES, right after the delimiter before a BeginString
+    static constexpr char MESSAGE_START[] = {Delimiter, '8', '=', 'F', 'I', 'X'};
+    const std::string_view message_start(MESSAGE_START, sizeof(MESSAGE_START));
+    chunk_starts_.assign(1, 0);
+    for (size_t cut = CHUNK_BYTES; cut < buffer.size();) {
+        const size_t found = buffer.find(message_start, cut - 1);
+        if (found == std::string_view::npos) {
+            break;
+        }
+        chunk_starts_.push_back(found + 1);
+        cut = found + 1 + CHUNK_BYTES;
+    }
+    chunk_starts_.push_back(buffer.size());
+
+    const size_t chunks = chunk_starts_.size() - 1;
+    if (chunk_results_.size() < chunks) {
+        chunk_results_.resize(chunks);
+    }
+
+    pool_.run(chunks, [&](size_t chunk, size_t worker) {
+        const Clock::time_point chunk_start = Clock::now();
+        WorkerState& state = workers_[worker];
+        std::vector<FIXMessage>& results = chunk_results_[chunk];
+        std::string_view rest =
+            buffer.substr(chunk_starts_[chunk], chunk_starts_[chunk + 1] - chunk_starts_[chunk]);
+        std::array<std::string_view, FRAME_BATCH> views;
+
+        results.clear();
+        while (!rest.empty()) {
+            const FrameResult framed = frame_messages<Delimiter>(rest, views, true);
+            const size_t count = framed.message_count;
+            if (count > 0) {
+                const size_t first = results.size();
+                results.resize(first + count);
+                parse_simd_batch<Delimiter>(std::span(views.data(), count), state.context,
+                                            std::span(results).subspan(first));
+                state.stats.messages += count;
+                state.stats.bytes += total_bytes(std::span(views.data(), count));
+            }
+            if (framed.consumed == 0) {
+                break;
+            }
+            rest.remove_prefix(framed.consumed);
+        }
+        state.stats.busy_seconds += seconds_since(chunk_start);
+    });
+
+    // Chunks are in buffer order, so concatenating them keeps message order
+    size_t total = 0;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        total += chunk_results_[chunk].size();
+    }
+    out.clear();
+    out.reserve(total);
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        out.insert(out.end(), chunk_results_[chunk].begin(), chunk_results_[chunk].end());
+    }
+
+    return collect_stats(seconds_since(start));
+}
+
+template ParallelParseStats ParallelParser::parse<'|'>(std::span<const std::string_view>, std::span<FIXMessage>);
+template ParallelParseStats ParallelParser::parse<SOH>(std::span<const std::string_view>, std::span<FIXMessage>);
+template ParallelParseStats ParallelParser::parse_buffer<'|'>(std::string_view, std::vector<FIXMessage>&);
+template ParallelParseStats ParallelParser::parse_buffer<SOH>(std::string_view, std::vector<FIXMessage>&);
+
+} // namespace simd_parser
@@ -1,6 +1,8 @@
 #include "parser.hpp"
+#include "framer.hpp"
 #include "simd_utils.hpp"
 #include <algorithm>
+#include <array>
 
 namespace simd_parser {
 
@@ -11,19 +13,18 @@ namespace {
  * Field format: "tag=value"
  *
  * @param field String view of the field
- * @param tag Output parameter for tag number
+ * @param slot Output parameter for the slot the tag maps to
  * @param value Output parameter for value string
  * @return true if successfully split, false otherwise
  */
-bool split_field(std::string_view field, uint32_t& tag, std::string_view& value) {
+bool split_field(std::string_view field, FieldSlot& slot, std::string_view& value) {
     size_t eq_pos = field.find('=');
     if (eq_pos == std::string_view::npos || eq_pos == 0) {
         return false;
     }
 
-    // Extract tag number
-    std::string_view tag_str = field.substr(0, eq_pos);
-    tag = parse_int(tag_str);
+    // Map the tag digits straight to a slot
+    slot = field_slot(field.substr(0, eq_pos));
 
     // Extract value (everything after '=')
     value = field.substr(eq_pos + 1);
@@ -31,49 +32,180 @@ bool split_field(std::string_view field, uint32_t& tag, std::string_view& value)
     return true;
 }
 
+using FieldSetter = void (*)(FIXMessage&, std::string_view);
+
 /**
- * Populates a FIXMessage structure from a tag-value pair.
+ * Stores a value in its FIXMessage member, indexed by FieldSlot.
+ * CheckSum is validated by the parsers themselves, so it has nothing to store.
  */
-void populate_message(FIXMessage& msg, uint32_t tag, std::string_view value) {
-    switch (tag) {
-        case static_cast<uint32_t>(FIXTag::MessageType):
-            msg.message_type = value;
-            break;
-        case static_cast<uint32_t>(FIXTag::Symbol):
-            msg.symbol = value;
-            break;
-        case static_cast<uint32_t>(FIXTag::SenderCompID):
-            msg.sender = value;
-            break;
-        case static_cast<uint32_t>(FIXTag::TargetCompID):
-            msg.target = value;
-            break;
-        case static_cast<uint32_t>(FIXTag::Side):
-            msg.side = parse_int(value);
-            break;
-        case static_cast<uint32_t>(FIXTag::Price):
-            msg.price = parse_double(value);
-            break;
-        case static_cast<uint32_t>(FIXTag::OrderQty):
-            msg.quantity = parse_int(value);
-            break;
-        default:
-            // Ignore unknown tags
-            break;
+constexpr FieldSetter FIELD_SETTERS[FIELD_SLOT_COUNT] = {
+    /* None */        [](FIXMessage&, std::string_view) {},
+    /* MessageType */ [](FIXMessage& msg, std::string_view value) { msg.message_type = value; },
+    /* Symbol */      [](FIXMessage& msg, std::string_view value) { msg.symbol = value; },
+    /* Sender */      [](FIXMessage& msg, std::string_view value) { msg.sender = value; },
+    /* Target */      [](FIXMessage& msg, std::string_view value) { msg.target = value; },
+    /* Side */        [](FIXMessage& msg, std::string_view value) { msg.side = parse_int(value); },
+    /* Price */       [](FIXMessage& msg, std::string_view value) {
+                          msg.price_fallback = parse_price_fallback(value, msg.price_decimal);
+                      },
+    /* OrderQty */    [](FIXMessage& msg, std::string_view value) { msg.quantity = parse_int(value); },
+    /* BodyLength */  [](FIXMessage& msg, std::string_view value) { msg.body_length = parse_int(value); },
+    /* SendingTime */ [](FIXMessage& msg, std::string_view value) { msg.sending_time = parse_timestamp(value); },
+    /* TransactTime */[](FIXMessage& msg, std::string_view value) { msg.transact_time = parse_timestamp(value); },
+    /* CheckSum */    [](FIXMessage&, std::string_view) {},
+};
+
+/**
+ * Populates a FIXMessage structure from a slot-value pair.
+ */
+void populate_message(FIXMessage& msg, FieldSlot slot, std::string_view value) {
+    // Most fields on the wire are not stored; skip the indirect call for them
+    if (slot != FieldSlot::None) {
+        FIELD_SETTERS[static_cast<size_t>(slot)](msg, value);
+    }
+}
+
+/**
+ * Sets symbol_id from the context's symbol table, if it has one. Runs once
+ * per message after the field walk, so a repeated tag 55 is interned once.
+ */
+void intern_symbol(FIXMessage& msg, const ParserContext& context) {
+    if (context.symbols != nullptr) {
+        msg.symbol_id = context.symbols->intern(msg.symbol);
+    }
+}
+
+/**
+ * Checks a CheckSum (tag 10) value against the byte sum of the message
+ * preceding the trailer. FIX requires exactly three digits ("007").
+ */
+bool checksum_matches(std::string_view value, uint8_t expected) {
+    if (value.size() != 3) {
+        return false;
+    }
+    for (char c : value) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+    }
+    return parse_int(value) == expected;
+}
+
+/**
+ * Reads BodyLength (tag 9) from the standard header and reports whether the
+ * message is shorter than it declares. Runs before any scan of the body, so
+ * a truncated message costs only its first two fields.
+ *
+ * Messages without a "8=...|9=N|" header are never reported as truncated.
+ */
+template <char Delimiter>
+bool is_truncated(std::string_view message, int32_t& body_length) {
+    BodyLocation location;
+    if (locate_body<Delimiter>(message, location) != FrameStatus::Complete) {
+        return false;
     }
+    body_length = static_cast<int32_t>(location.body_length);
+    return message.size() < location.body_end();
+}
+
+/**
+ * parse_simd() body. IndexFields selects at compile time whether every field
+ * is also recorded in `fields`, so the plain overload pays nothing for it.
+ */
+template <char Delimiter, bool IndexFields>
+FIXMessage parse_simd_impl(std::string_view message, ParserContext& context, FieldIndex* fields) {
+    FIXMessage result;
+
+    if constexpr (IndexFields) {
+        fields->reset(message);
+    }
+
+    if (message.empty() || is_truncated<Delimiter>(message, result.body_length)) {
+        return result;
+    }
+
+    // Stage 1: classify every byte into delimiter / '=' bitmasks with SIMD
+    build_structural_index<Delimiter>(message, context.index);
+
+    // Stage 2: walk fields straight off the bitmasks
+    const StructuralIndex& index = context.index;
+    for_each_field(message, index, [&](std::string_view tag_str, std::string_view value) {
+        FieldSlot slot;
+        if constexpr (IndexFields) {
+            const uint32_t tag = parse_tag(tag_str);
+            fields->add(tag, value);
+            slot = field_slot(tag);
+        } else {
+            slot = field_slot(tag_str);
+        }
+        if (slot == FieldSlot::CheckSum) {
+            // Stage 1 summed the whole message; drop the trailer's own bytes
+            std::string_view trailer = message.substr(tag_str.data() - message.data());
+            uint8_t expected = static_cast<uint8_t>(index.byte_sum - compute_checksum_scalar(trailer));
+            result.checksum_valid = checksum_matches(value, expected);
+        }
+        populate_message(result, slot, value);
+    });
+
+    // Validate that we got essential fields
+    result.valid = !result.message_type.empty() && !result.symbol.empty();
+    intern_symbol(result, context);
+
+    return result;
+}
+
+// First window indexed by the FieldMask parse_simd(); header fields such as
+// 35 and 55 usually sit in the first 64 bytes
+constexpr size_t FIRST_SELECTIVE_WINDOW = 64;
+
+/**
+ * Offset just past the last delimiter covered by a structural index, or 0
+ * if it has none.
+ */
+size_t end_of_last_field(const StructuralIndex& index) {
+    for (size_t block = index.block_count(); block-- > 0;) {
+        const uint64_t delimiters = index.delimiter_masks[block];
+        if (delimiters != 0) {
+            return block * 64 + (63 - __builtin_clzll(delimiters)) + 1;
+        }
+    }
+    return 0;
 }
 
 } // anonymous namespace
 
+ParserContext::ParserContext(size_t max_message_size) {
+    reserve(max_message_size);
+}
+
+void ParserContext::reserve(size_t max_message_size) {
+    // Worst case is a message made only of delimiters ("||||...")
+    delimiters.reserve(max_message_size);
+    index.delimiter_masks.reserve((max_message_size + 63) / 64);
+    index.equals_masks.reserve((max_message_size + 63) / 64);
+}
+
+ParserContext& thread_parser_context() {
+    thread_local ParserContext context;
+    return context;
+}
+
+template <char Delimiter>
 FIXMessage parse_scalar(std::string_view message) {
+    return parse_scalar<Delimiter>(message, thread_parser_context());
+}
+
+template <char Delimiter>
+FIXMessage parse_scalar(std::string_view message, ParserContext& context) {
     FIXMessage result;
 
-    if (message.empty()) {
+    if (message.empty() || is_truncated<Delimiter>(message, result.body_length)) {
         return result;
     }
 
     // Find all delimiters using scalar implementation
-    std::vector<size_t> delimiters = find_delimiters_scalar(message, '|');
+    std::vector<size_t>& delimiters = context.delimiters;
+    find_delimiters_scalar(message, Delimiter, delimiters);
 
     // Parse fields between delimiters
     size_t start = 0;
@@ -81,11 +213,15 @@ FIXMessage parse_scalar(std::string_view message) {
         if (delim_pos > start) {
             std::string_view field = message.substr(start, delim_pos - start);
 
-            uint32_t tag;
+            FieldSlot slot;
             std::string_view value;
 
-            if (split_field(field, tag, value)) {
-                populate_message(result, tag, value);
+            if (split_field(field, slot, value)) {
+                if (slot == FieldSlot::CheckSum) {
+                    result.checksum_valid = checksum_matches(
+                        value, compute_checksum_scalar(message.substr(0, start)));
+                }
+                populate_message(result, slot, value);
             }
         }
         start = delim_pos + 1;
@@ -95,72 +231,411 @@ FIXMessage parse_scalar(std::string_view message) {
     if (start < message.size()) {
         std::string_view field = message.substr(start);
 
-        uint32_t tag;
+        FieldSlot slot;
         std::string_view value;
 
-        if (split_field(field, tag, value)) {
-            populate_message(result, tag, value);
+        if (split_field(field, slot, value)) {
+            if (slot == FieldSlot::CheckSum) {
+                result.checksum_valid = checksum_matches(
+                    value, compute_checksum_scalar(message.substr(0, start)));
+            }
+            populate_message(result, slot, value);
         }
     }
 
     // Validate that we got essential fields
     result.valid = !result.message_type.empty() && !result.symbol.empty();
+    intern_symbol(result, context);
 
     return result;
 }
 
+template <char Delimiter>
 FIXMessage parse_simd(std::string_view message) {
+    return parse_simd<Delimiter>(message, thread_parser_context());
+}
+
+template <char Delimiter>
+FIXMessage parse_simd(std::string_view message, ParserContext& context) {
+    return parse_simd_impl<Delimiter, false>(message, context, nullptr);
+}
+
+template <char Delimiter>
+FIXMessage parse_simd(std::string_view message, ParserContext& context, FieldIndex& fields) {
+    return parse_simd_impl<Delimiter, true>(message, context, &fields);
+}
+
+template <char Delimiter>
+FIXMessage parse_simd(std::string_view message, FieldMask fields) {
+    return parse_simd<Delimiter>(message, thread_parser_context(), fields);
+}
+
+template <char Delimiter>
+FIXMessage parse_simd(std::string_view message, ParserContext& context, FieldMask fields) {
     FIXMessage result;
 
+    if (message.empty() || is_truncated<Delimiter>(message, result.body_length)) {
+        return result;
+    }
+
+    // Index the message in doubling windows so a scan that finds every
+    // requested field early never classifies the rest. Each window starts at
+    // the field left open by the previous one.
+    uint32_t missing = fields.bits();
+    size_t start = 0;
+    size_t window = FIRST_SELECTIVE_WINDOW;
+
+    while (missing != 0 && start < message.size()) {
+        std::string_view chunk = message.substr(start, window);
+        StructuralIndex& index = context.index;
+        build_structural_index<Delimiter>(chunk, index);
+
+        window *= 2;
+        if (start + chunk.size() < message.size()) {
+            // Only walk complete fields; the rest goes into the next window
+            const size_t end = end_of_last_field(index);
+            if (end == 0) {
+                continue;  // One field longer than the window
+            }
+            index.length = end;
+        }
+
+        for_each_field(chunk, index, [&](std::string_view tag_str, std::string_view value) {
+            const FieldSlot slot = field_slot(tag_str);
+            if (!fields.contains(slot) || (missing & FieldMask::bit(slot)) == 0) {
+                return true;
+            }
+            if (slot == FieldSlot::CheckSum) {
+                // Windows overlap, so sum the bytes before the trailer directly
+                const size_t trailer = static_cast<size_t>(tag_str.data() - message.data());
+                result.checksum_valid = checksum_matches(
+                    value, compute_checksum_simd(message.substr(0, trailer)));
+            }
+            populate_message(result, slot, value);
+            missing &= ~FieldMask::bit(slot);
+            return missing != 0;
+        });
+
+        start += index.length;
+    }
+
+    result.valid = !fields.empty() && missing == 0;
+    intern_symbol(result, context);
+
+    return result;
+}
+
+template <char Delimiter>
+LazyFIXMessage parse_lazy(std::string_view message) {
+    return parse_lazy<Delimiter>(message, thread_parser_context());
+}
+
+template <char Delimiter>
+LazyFIXMessage parse_lazy(std::string_view message, ParserContext& context) {
+    LazyFIXMessage result(message);
+
     if (message.empty()) {
         return result;
     }
+    BodyLocation location;
+    if (locate_body<Delimiter>(message, location) == FrameStatus::Complete &&
+        message.size() < location.body_end()) {
+        // Truncated: keep only the declared BodyLength, as parse_simd() does
+        const size_t value_end = location.body_start - 1;
+        const size_t value_start = message.rfind('=', value_end) + 1;
+        result.record(FieldSlot::BodyLength, message.substr(value_start, value_end - value_start));
+        return result;
+    }
 
-    // Find all delimiters using SIMD implementation
-    std::vector<size_t> delimiters = find_delimiters_simd(message, '|');
+    build_structural_index<Delimiter>(message, context.index);
 
-    // Parse fields between delimiters
-    size_t start = 0;
-    for (size_t delim_pos : delimiters) {
-        if (delim_pos > start) {
-            std::string_view field = message.substr(start, delim_pos - start);
+    // Only offsets are recorded; conversions wait for the accessors
+    const StructuralIndex& index = context.index;
+    for_each_field(message, index, [&](std::string_view tag_str, std::string_view value) {
+        const FieldSlot slot = field_slot(tag_str);
+        if (slot == FieldSlot::None) {
+            return;
+        }
+        if (slot == FieldSlot::CheckSum) {
+            std::string_view trailer = message.substr(tag_str.data() - message.data());
+            uint8_t expected = static_cast<uint8_t>(index.byte_sum - compute_checksum_scalar(trailer));
+            result.set_checksum_valid(checksum_matches(value, expected));
+        }
+        result.record(slot, value);
+    });
 
-            uint32_t tag;
-            std::string_view value;
+    return result;
+}
 
-            if (split_field(field, tag, value)) {
-                populate_message(result, tag, value);
-            }
+template <char Delimiter>
+void parse_simd_batch(std::span<const std::string_view> messages, ParserContext& context,
+                      std::span<FIXMessage> out) {
+    std::array<std::string_view, BATCH_CONVERT_SIZE> sides;
+    std::array<std::string_view, BATCH_CONVERT_SIZE> prices;
+    std::array<std::string_view, BATCH_CONVERT_SIZE> quantities;
+    std::array<std::string_view, BATCH_CONVERT_SIZE> body_lengths;
+    std::array<int32_t, BATCH_CONVERT_SIZE> ints;
+    std::array<double, BATCH_CONVERT_SIZE> price_values;
+    std::array<Decimal64, BATCH_CONVERT_SIZE> decimals;
+
+    for (size_t start = 0; start < messages.size(); start += BATCH_CONVERT_SIZE) {
+        const size_t count = std::min(BATCH_CONVERT_SIZE, messages.size() - start);
+
+        // Scan: string fields are final, numeric values are only located
+        for (size_t i = 0; i < count; ++i) {
+            const LazyFIXMessage lazy = parse_lazy<Delimiter>(messages[start + i], context);
+            FIXMessage& msg = out[start + i];
+            msg = FIXMessage();
+            msg.message_type = lazy.message_type();
+            msg.symbol = lazy.symbol();
+            msg.sender = lazy.sender();
+            msg.target = lazy.target();
+            msg.sending_time = lazy.sending_time();
+            msg.transact_time = lazy.transact_time();
+            msg.valid = lazy.valid();
+            msg.checksum_valid = lazy.checksum_valid();
+            intern_symbol(msg, context);
+
+            sides[i] = lazy.value(FieldSlot::Side);
+            prices[i] = lazy.value(FieldSlot::Price);
+            quantities[i] = lazy.value(FieldSlot::OrderQty);
+            body_lengths[i] = lazy.value(FieldSlot::BodyLength);
+        }
+
+        // Convert: one call per field across the whole chunk
+        parse_int_batch(std::span(sides.data(), count), ints);
+        for (size_t i = 0; i < count; ++i) {
+            out[start + i].side = ints[i];
+        }
+        parse_int_batch(std::span(quantities.data(), count), ints);
+        for (size_t i = 0; i < count; ++i) {
+            out[start + i].quantity = ints[i];
+        }
+        parse_int_batch(std::span(body_lengths.data(), count), ints);
+        for (size_t i = 0; i < count; ++i) {
+            out[start + i].body_length = ints[i];
+        }
+        parse_price_batch(std::span(prices.data(), count), price_values, decimals);
+        for (size_t i = 0; i < count; ++i) {
+            // Same split as parse_price_fallback(): keep the double only where
+            // the decimal is missing or would not convert exactly
+            const bool exact = decimals[i].mantissa != 0 && decimals[i].converts_exactly();
+            out[start + i].price_decimal = decimals[i];
+            out[start + i].price_fallback = exact ? 0.0 : price_values[i];
         }
-        start = delim_pos + 1;
     }
+}
 
-    // Handle last field if message doesn't end with delimiter
-    if (start < message.size()) {
-        std::string_view field = message.substr(start);
+template <char Delimiter>
+FrameResult parse_batch(std::string_view buffer, ParserContext& context, MessageBatch& out,
+                        bool end_of_stream) {
+    std::array<std::string_view, BATCH_CONVERT_SIZE> messages;
+    std::array<std::string_view, BATCH_CONVERT_SIZE> sides;
+    std::array<std::string_view, BATCH_CONVERT_SIZE> prices;
+    std::array<std::string_view, BATCH_CONVERT_SIZE> quantities;
+    std::array<Decimal64, BATCH_CONVERT_SIZE> decimals;
+    FrameResult total;
+
+    out.reset(buffer);
+    for (;;) {
+        const FrameResult framed =
+            frame_messages<Delimiter>(buffer.substr(total.consumed), messages, end_of_stream);
+        total.consumed += framed.consumed;
+        const size_t count = framed.message_count;
+        if (count == 0) {
+            break;
+        }
 
-        uint32_t tag;
-        std::string_view value;
+        // Scan: offsets and flags go straight into the columns
+        const size_t first = out.append(count);
+        for (size_t i = 0; i < count; ++i) {
+            const std::string_view message = messages[i];
+            const LazyFIXMessage lazy = parse_lazy<Delimiter>(message, context);
+            const std::string_view symbol = lazy.symbol();
+            const size_t row = first + i;
+
+            out.offsets[row] = static_cast<uint32_t>(message.data() - buffer.data());
+            out.lengths[row] = static_cast<uint32_t>(message.size());
+            out.msg_types[row] = pack_msg_type(lazy.message_type());
+            if (!symbol.empty()) {
+                out.symbol_offsets[row] = static_cast<uint32_t>(symbol.data() - buffer.data());
+                out.symbol_lengths[row] = static_cast<uint16_t>(symbol.size());
+                if (context.symbols != nullptr) {
+                    out.symbol_ids[row] = context.symbols->intern(symbol);
+                }
+            }
+            out.valid[row] = lazy.valid();
+            out.checksum_valid[row] = lazy.checksum_valid();
+
+            sides[i] = lazy.value(FieldSlot::Side);
+            prices[i] = lazy.value(FieldSlot::Price);
+            quantities[i] = lazy.value(FieldSlot::OrderQty);
+        }
+
+        // Convert: one call per field, written into the column in place
+        parse_int_batch(std::span(sides.data(), count), std::span(out.sides.data() + first, count));
+        parse_int_batch(std::span(quantities.data(), count),
+                        std::span(out.quantities.data() + first, count));
+        parse_price_batch(std::span(prices.data(), count), std::span(out.prices.data() + first, count),
+                          decimals);
 
-        if (split_field(field, tag, value)) {
-            populate_message(result, tag, value);
+        total.message_count += count;
+        if (count < messages.size()) {
+            break;
         }
     }
+    out.pad();
 
-    // Validate that we got essential fields
-    result.valid = !result.message_type.empty() && !result.symbol.empty();
+    return total;
+}
+
+template <char Delimiter>
+FrameResult parse_batch(std::string_view buffer, MessageBatch& out, bool end_of_stream) {
+    return parse_batch<Delimiter>(buffer, thread_parser_context(), out, end_of_stream);
+}
+
+template <char Delimiter>
+FIXMessage parse_market_data(std::string_view message, ParserContext& context,
+                             MarketDataEntries& entries) {
+    FIXMessage result;
+    entries.clear();
+
+    if (message.empty() || is_truncated<Delimiter>(message, result.body_length)) {
+        return result;
+    }
+
+    build_structural_index<Delimiter>(message, context.index);
+
+    // The first tag after NoMDEntries delimits entries: each time it recurs
+    // a new row starts
+    constexpr uint32_t NOT_IN_GROUP = 0;
+    uint32_t entry_delimiter = NOT_IN_GROUP;
+    bool in_group = false;
+
+    const StructuralIndex& index = context.index;
+    for_each_field(message, index, [&](std::string_view tag_str, std::string_view value) {
+        const uint32_t tag = parse_tag(tag_str);
+        const FieldSlot slot = field_slot(tag);
+
+        if (slot == FieldSlot::CheckSum) {
+            std::string_view trailer = message.substr(tag_str.data() - message.data());
+            uint8_t expected = static_cast<uint8_t>(index.byte_sum - compute_checksum_scalar(trailer));
+            result.checksum_valid = checksum_matches(value, expected);
+            in_group = false;
+            return;
+        }
+
+        if (!in_group) {
+            if (tag == static_cast<uint32_t>(MDTag::NoMDEntries)) {
+                entries.declared_count = parse_int(value);
+                in_group = true;
+            } else {
+                populate_message(result, slot, value);
+            }
+            return;
+        }
+
+        if (entry_delimiter == NOT_IN_GROUP) {
+            entry_delimiter = tag;
+        }
+        if (tag == entry_delimiter) {
+            entries.add_entry();
+        }
+
+        const size_t row = entries.size() - 1;
+        switch (tag) {
+            case static_cast<uint32_t>(MDTag::MDUpdateAction):
+                entries.actions[row] = static_cast<uint8_t>(parse_int(value));
+                break;
+            case static_cast<uint32_t>(MDTag::MDEntryType):
+                entries.entry_types[row] = value.empty() ? '\0' : value[0];
+                break;
+            case static_cast<uint32_t>(MDTag::MDEntryPx):
+                entries.prices[row] = parse_double(value);
+                break;
+            case static_cast<uint32_t>(MDTag::MDEntrySize):
+                entries.sizes[row] = parse_double(value);
+                break;
+            case static_cast<uint32_t>(FIXTag::Symbol):
+                entries.symbols[row] = value;
+                break;
+            default:
+                // Other group fields (MDEntryID, MDEntryTime, ...) are not stored
+                break;
+        }
+    });
+
+    entries.pad();
+
+    result.valid = result.message_type == "X" && !entries.empty() &&
+                   static_cast<size_t>(entries.declared_count) == entries.size();
+    intern_symbol(result, context);
 
     return result;
 }
 
+template <char Delimiter>
 FIXMessage parse_auto(std::string_view message) {
-    static bool avx512_available = has_avx512_support();
+    // parse_simd already runs on the widest available tier (AVX-512, AVX2
+    // or SSE4.2), so only CPUs without any of them take the scalar path
+    static const bool simd_available = cpu_features().best_level() != SimdLevel::Scalar;
 
-    if (avx512_available) {
-        return parse_simd(message);
+    if (simd_available) {
+        return parse_simd<Delimiter>(message);
     } else {
-        return parse_scalar(message);
+        return parse_scalar<Delimiter>(message);
     }
 }
 
+char detect_delimiter(std::string_view data) {
+    for (char c : data) {
+        if (c == SOH || c == '|') {
+            return c;
+        }
+    }
+    return '\0';
+}
+
+ParseFunction parser_for_delimiter(char delimiter) {
+    switch (delimiter) {
+        case '|':
+            return parse_auto<'|'>;
+        case SOH:
+            return parse_auto<SOH>;
+        default:
+            return nullptr;
+    }
+}
+
+template FIXMessage parse_scalar<'|'>(std::string_view);
+template FIXMessage parse_scalar<SOH>(std::string_view);
+template FIXMessage parse_scalar<'|'>(std::string_view, ParserContext&);
+template FIXMessage parse_scalar<SOH>(std::string_view, ParserContext&);
+template FIXMessage parse_simd<'|'>(std::string_view);
+template FIXMessage parse_simd<SOH>(std::string_view);
+template FIXMessage parse_simd<'|'>(std::string_view, ParserContext&);
+template FIXMessage parse_simd<SOH>(std::string_view, ParserContext&);
+template FIXMessage parse_simd<'|'>(std::string_view, ParserContext&, FieldIndex&);
+template FIXMessage parse_simd<SOH>(std::string_view, ParserContext&, FieldIndex&);
+template FIXMessage parse_simd<'|'>(std::string_view, FieldMask);
+template FIXMessage parse_simd<SOH>(std::string_view, FieldMask);
+template FIXMessage parse_simd<'|'>(std::string_view, ParserContext&, FieldMask);
+template FIXMessage parse_simd<SOH>(std::string_view, ParserContext&, FieldMask);
+template LazyFIXMessage parse_lazy<'|'>(std::string_view);
+template LazyFIXMessage parse_lazy<SOH>(std::string_view);
+template LazyFIXMessage parse_lazy<'|'>(std::string_view, ParserContext&);
+template LazyFIXMessage parse_lazy<SOH>(std::string_view, ParserContext&);
+template void parse_simd_batch<'|'>(std::span<const std::string_view>, ParserContext&,
+                                   std::span<FIXMessage>);
+template void parse_simd_batch<SOH>(std::span<const std::string_view>, ParserContext&,
+                                  std::span<FIXMessage>);
+template FrameResult parse_batch<'|'>(std::string_view, ParserContext&, MessageBatch&, bool);
+template FrameResult parse_batch<SOH>(std::string_view, ParserContext&, MessageBatch&, bool);
+template FrameResult parse_batch<'|'>(std::string_view, MessageBatch&, bool);
+template FrameResult parse_batch<SOH>(std::string_view, MessageBatch&, bool);
+template FIXMessage parse_market_data<'|'>(std::string_view, ParserContext&, MarketDataEntries&);
+template FIXMessage parse_market_data<SOH>(std::string_view, ParserContext&, MarketDataEntries&);
+template FIXMessage parse_auto<'|'>(std::string_view);
+template FIXMessage parse_auto<SOH>(std::string_view);
+
 } // namespace simd_parser
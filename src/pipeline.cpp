@@ -0,0 +1,412 @@
+#include "pipeline.hpp"
+#include "framer.hpp"
+#include "parser.hpp"
+#include "ring_buffer.hpp"
+#include "shard_router.hpp"
+#include "symbol_table.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace simd_parser {
+
+namespace {
+
+// A message on its way from ingest to a parser
+struct ParseTask {
+    std::string_view message;
+    uint64_t sequence = 0;
+    uint32_t block = 0;
+};
+
+// Views framed per frame_messages() call
+constexpr size_t FRAME_BATCH = 256;
+
+/**
+ * Frames every message in a block.
+ *
+ * @return Bytes consumed (complete messages and skipped bytes)
+ */
+template <char Delimiter>
+size_t frame_block(std::string_view data, bool end_of_stream, std::vector<std::string_view>& messages) {
+    std::array<std::string_view, FRAME_BATCH> views;
+    size_t offset = 0;
+    messages.clear();
+    for (;;) {
+        const FrameResult result = frame_messages<Delimiter>(data.substr(offset), views, end_of_stream);
+        messages.insert(messages.end(), views.begin(), views.begin() + result.message_count);
+        offset += result.consumed;
+        if (result.message_count < views.size() || result.consumed == 0) {
+            return offset;
+        }
+    }
+}
+
+} // anonymous namespace
+
+struct ParsePipeline::Rings {
+    Rings(const PipelineOptions& options, bool with_output)
+        : free_blocks(options.block_count), parsers_running(options.parser_threads) {
+        input.reserve(options.parser_threads);
+        for (size_t i = 0; i < options.parser_threads; ++i) {
+            input.push_back(std::make_unique<SpscRing<ParseTask>>(options.ring_capacity));
+        }
+        if (with_output) {
+            output = std::make_unique<MpscRing<ParsedRecord>>(options.ring_capacity);
+        }
+        for (uint32_t block = 0; block < options.block_count; ++block) {
+            free_blocks.try_push(block);
+        }
+    }
+
+    std::vector<std::unique_ptr<SpscRing<ParseTask>>> input;  // Ingest → parser (or shard) i
+    std::unique_ptr<MpscRing<ParsedRecord>> output;           // Parsers → consumer (run() only)
+    MpscRing<uint32_t> free_blocks;                           // Consumer or shards → ingest
+    alignas(64) std::atomic<bool> ingest_done{false};
+    alignas(64) std::atomic<size_t> parsers_running;
+};
+
+ParsePipeline::ParsePipeline(const PipelineOptions& options) : options_(options) {
+    options_.parser_threads = std::max<size_t>(options_.parser_threads, 1);
+    options_.batch_size = std::max<size_t>(options_.batch_size, 1);
+    options_.block_count = std::max<size_t>(options_.block_count, 2);
+    options_.block_bytes = std::max<size_t>(options_.block_bytes, 256);
+    blocks_ = std::make_unique<char[]>(options_.block_count * options_.block_bytes);
+    pending_ = std::make_unique<std::atomic<uint32_t>[]>(options_.block_count);
+}
+
+ParsePipeline::~ParsePipeline() = default;
+
+template <char Delimiter>
+void ParsePipeline::parser_loop(Rings& rings, uint32_t parser, size_t& waits) {
+    SpscRing<ParseTask>& input = *rings.input[parser];
+    std::vector<ParseTask> tasks(options_.batch_size);
+    std::vector<ParsedRecord> records(options_.batch_size);
+    Backoff backoff;
+
+    for (;;) {
+        size_t count = input.try_pop(std::span(tasks));
+        if (count == 0) {
+            // Ingest publishes its last batch before setting ingest_done
+            if (!rings.ingest_done.load(std::memory_order_acquire)) {
+                backoff.wait();
+                continue;
+            }
+            count = input.try_pop(std::span(tasks));
+            if (count == 0) {
+                break;
+            }
+        }
+        backoff.reset();
+
+        for (size_t i = 0; i < count; ++i) {
+            records[i].sequence = tasks[i].sequence;
+            records[i].parser = parser;
+            records[i].block = tasks[i].block;
+            records[i].message = parse_auto<Delimiter>(tasks[i].message);
+        }
+
+        std::span<const ParsedRecord> pending(records.data(), count);
+        while (!pending.empty()) {
+            const size_t pushed = rings.output->try_push(pending);
+            if (pushed == 0) {
+                ++waits;
+                backoff.wait();
+            }
+            pending = pending.subspan(pushed);
+        }
+        backoff.reset();
+    }
+
+    rings.parsers_running.fetch_sub(1, std::memory_order_release);
+}
+
+void ParsePipeline::consumer_loop(Rings& rings, const Consumer& consumer, PipelineStats& stats) {
+    std::vector<ParsedRecord> records(options_.batch_size);
+    Backoff backoff;
+
+    for (;;) {
+        size_t count = rings.output->try_pop(std::span(records));
+        if (count == 0) {
+            // Parsers publish their last records before leaving
+            if (rings.parsers_running.load(std::memory_order_acquire) != 0) {
+                backoff.wait();
+                continue;
+            }
+            count = rings.output->try_pop(std::span(records));
+            if (count == 0) {
+                break;
+            }
+        }
+        backoff.reset();
+
+        const std::span<const ParsedRecord> batch(records.data(), count);
+        consumer(batch);
+        release_blocks(rings, batch);
+        stats.messages += count;
+        ++stats.consumer_batches;
+    }
+}
+
+template <char Delimiter>
+void ParsePipeline::shard_loop(Rings& rings, uint32_t shard, const ShardConsumer& consumer,
+                               ShardCounters& counters) {
+    SpscRing<ParseTask>& input = *rings.input[shard];
+    std::vector<ParseTask> tasks(options_.batch_size);
+    std::vector<ParsedRecord> records(options_.batch_size);
+    ShardCounters local;
+    Backoff backoff;
+
+    // Every message of a symbol lands here, so the table is shard-private
+    SymbolTable symbols;
+    ParserContext context;
+    context.symbols = &symbols;
+
+    for (;;) {
+        size_t count = input.try_pop(std::span(tasks));
+        if (count == 0) {
+            if (!rings.ingest_done.load(std::memory_order_acquire)) {
+                backoff.wait();
+                continue;
+            }
+            count = input.try_pop(std::span(tasks));
+            if (count == 0) {
+                break;
+            }
+        }
+        backoff.reset();
+
+        for (size_t i = 0; i < count; ++i) {
+            records[i].sequence = tasks[i].sequence;
+            records[i].parser = shard;
+            records[i].block = tasks[i].block;
+            records[i].message = parse_simd<Delimiter>(tasks[i].message, context);
+        }
+
+        const std::span<const ParsedRecord> batch(records.data(), count);
+        consumer(shard, batch);
+        release_blocks(rings, batch);
+        local.messages += count;
+        ++local.batches;
+    }
+
+    counters = local;
+}
+
+void ParsePipeline::release_blocks(Rings& rings, std::span<const ParsedRecord> records) {
+    // Records of one batch mostly share a block: one atomic per run of them
+    for (size_t i = 0; i < records.size();) {
+        const uint32_t block = records[i].block;
+        uint32_t count = 0;
+        for (; i < records.size() && records[i].block == block; ++i) {
+            ++count;
+        }
+        // The last release hands the block back; the free ring holds every
+        // block, so the push never fails
+        if (pending_[block].fetch_sub(count, std::memory_order_acq_rel) == count) {
+            rings.free_blocks.try_push(block);
+        }
+    }
+}
+
+template <char Delimiter, typename Dispatch>
+void ParsePipeline::ingest(Rings& rings, const Source& source, Dispatch&& dispatch, PipelineStats& stats) {
+    const size_t block_bytes = options_.block_bytes;
+    std::vector<std::string_view> messages;
+    Backoff backoff;
+
+    auto take_block = [&] {
+        uint32_t block;
+        while (!rings.free_blocks.try_pop(block)) {
+            ++stats.ingest_waits;
+            backoff.wait();
+        }
+        backoff.reset();
+        return block;
+    };
+
+    uint32_t current = take_block();
+    size_t filled = 0;
+    bool end_of_stream = false;
+    for (;;) {
+        char* data = block_data(current);
+        if (filled < block_bytes) {
+            const size_t read = source(std::span<char>(data + filled, block_bytes - filled));
+            end_of_stream = read == 0;
+            filled += read;
+            stats.bytes += read;
+        }
+
+        const std::string_view view(data, filled);
+        const bool full = filled == block_bytes;
+        size_t consumed = frame_block<Delimiter>(view, end_of_stream, messages);
+        if (messages.empty() && full && !end_of_stream) {
+            // One message larger than a block: pass it on truncated
+            consumed = frame_block<Delimiter>(view, true, messages);
+        }
+
+        if (messages.empty()) {
+            if (end_of_stream) {
+                break;
+            }
+            // Drop skipped bytes (all of them if the block is full of noise)
+            const size_t keep = full && consumed == 0 ? 0 : filled - consumed;
+            std::memmove(data, data + filled - keep, keep);
+            filled = keep;
+            continue;
+        }
+
+        // Move the incomplete tail out before the block can be recycled
+        const std::string_view tail = view.substr(consumed);
+        uint32_t next = current;
+        if (!end_of_stream) {
+            next = take_block();
+            std::memcpy(block_data(next), tail.data(), tail.size());
+        }
+
+        pending_[current].store(static_cast<uint32_t>(messages.size()), std::memory_order_relaxed);
+        ++stats.blocks;
+        dispatch(std::span<const std::string_view>(messages), current);
+
+        if (end_of_stream) {
+            break;
+        }
+        current = next;
+        filled = tail.size();
+    }
+
+    rings.ingest_done.store(true, std::memory_order_release);
+}
+
+template <char Delimiter>
+PipelineStats ParsePipeline::run(const Source& source, const Consumer& consumer) {
+    const auto start = std::chrono::steady_clock::now();
+    PipelineStats stats;
+    Rings rings(options_, true);
+    std::vector<size_t> parser_waits(options_.parser_threads);
+
+    std::vector<std::thread> threads;
+    threads.reserve(options_.parser_threads + 1);
+    for (uint32_t parser = 0; parser < options_.parser_threads; ++parser) {
+        threads.emplace_back([&, parser] { parser_loop<Delimiter>(rings, parser, parser_waits[parser]); });
+    }
+    threads.emplace_back([&] { consumer_loop(rings, consumer, stats); });
+
+    const size_t parsers = options_.parser_threads;
+    std::vector<ParseTask> tasks(options_.batch_size);
+    uint64_t sequence = 0;
+    size_t next_parser = 0;
+    Backoff backoff;
+
+    // Deals a block's messages to the parser rings, batch_size at a time,
+    // round-robin and skipping rings that are full
+    auto dispatch = [&](std::span<const std::string_view> messages, uint32_t block) {
+        for (size_t first = 0; first < messages.size();) {
+            const size_t count = std::min(tasks.size(), messages.size() - first);
+            for (size_t i = 0; i < count; ++i) {
+                tasks[i] = ParseTask{messages[first + i], sequence++, block};
+            }
+            std::span<const ParseTask> batch(tasks.data(), count);
+            while (!batch.empty()) {
+                size_t pushed = 0;
+                for (size_t tried = 0; tried < parsers && pushed == 0; ++tried) {
+                    pushed = rings.input[next_parser]->try_push(batch);
+                    next_parser = (next_parser + 1) % parsers;
+                }
+                if (pushed == 0) {
+                    ++stats.ingest_waits;
+                    backoff.wait();
+                }
+                batch = batch.subspan(pushed);
+            }
+            backoff.reset();
+            first += count;
+        }
+    };
+
+    // Ingest and the consumer thread update disjoint fields of stats
+    ingest<Delimiter>(rings, source, dispatch, stats);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t waits : parser_waits) {
+        stats.parser_waits += waits;
+    }
+    stats.wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+template <char Delimiter>
+PipelineStats ParsePipeline::run_sharded(const Source& source, const ShardConsumer& consumer) {
+    const auto start = std::chrono::steady_clock::now();
+    const size_t shards = options_.parser_threads;
+    PipelineStats stats;
+    Rings rings(options_, false);
+    std::vector<ShardCounters> counters(shards);
+
+    std::vector<std::thread> threads;
+    threads.reserve(shards);
+    for (uint32_t shard = 0; shard < shards; ++shard) {
+        threads.emplace_back([&, shard] { shard_loop<Delimiter>(rings, shard, consumer, counters[shard]); });
+    }
+
+    std::vector<std::vector<ParseTask>> staged(shards);
+    for (std::vector<ParseTask>& tasks : staged) {
+        tasks.reserve(options_.batch_size);
+    }
+    uint64_t sequence = 0;
+    Backoff backoff;
+
+    auto flush = [&](uint32_t shard) {
+        std::span<const ParseTask> batch(staged[shard]);
+        while (!batch.empty()) {
+            const size_t pushed = rings.input[shard]->try_push(batch);
+            if (pushed == 0) {
+                ++stats.ingest_waits;
+                backoff.wait();
+            }
+            batch = batch.subspan(pushed);
+        }
+        backoff.reset();
+        staged[shard].clear();
+    };
+
+    // Routes each message to the shard owning its symbol. Every shard is
+    // flushed at the end of the block so no block waits on a partial batch.
+    auto dispatch = [&](std::span<const std::string_view> messages, uint32_t block) {
+        for (std::string_view message : messages) {
+            const uint32_t shard = symbol_shard(scan_symbol<Delimiter>(message), shards);
+            staged[shard].push_back(ParseTask{message, sequence++, block});
+            if (staged[shard].size() == options_.batch_size) {
+                flush(shard);
+            }
+        }
+        for (uint32_t shard = 0; shard < shards; ++shard) {
+            if (!staged[shard].empty()) {
+                flush(shard);
+            }
+        }
+    };
+
+    ingest<Delimiter>(rings, source, dispatch, stats);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const ShardCounters& shard : counters) {
+        stats.messages += shard.messages;
+        stats.consumer_batches += shard.batches;
+    }
+    stats.wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+template PipelineStats ParsePipeline::run<'|'>(const Source&, const Consumer&);
+template PipelineStats ParsePipeline::run<SOH>(const Source&, const Consumer&);
+template PipelineStats ParsePipeline::run_sharded<'|'>(const Source&, const ShardConsumer&);
+template PipelineStats ParsePipeline::run_sharded<SOH>(const Source&, const ShardConsumer&);
+
+} // namespace simd_parser
@@ -0,0 +1,154 @@
+#include "shard_router.hpp"
+#include "swar.hpp"
+#include <cstring>
+#include <immintrin.h>
+
+namespace simd_parser {
+
+namespace {
+
+constexpr std::string_view SYMBOL_TAG = "55=";
+
+constexpr uint64_t SHARD_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+using SymbolScan = size_t (*)(const char* data, size_t size, char delimiter);
+
+/**
+ * Returns the value offset of the first "<delim>55=" at or after `from`, or
+ * `size` if there is none.
+ */
+size_t find_tag_scalar(const char* data, size_t size, size_t from, char delimiter) {
+    const char pattern[] = {delimiter, '5', '5', '='};
+    const std::string_view text(data, size);
+    const size_t pos = text.find(std::string_view(pattern, sizeof(pattern)), from);
+    return pos == std::string_view::npos ? size : pos + sizeof(pattern);
+}
+
+size_t scan_scalar(const char* data, size_t size, char delimiter) {
+    return find_tag_scalar(data, size, 0, delimiter);
+}
+
+__attribute__((target("avx2")))
+size_t scan_avx2(const char* data, size_t size, char delimiter) {
+    const __m256i delimiters = _mm256_set1_epi8(delimiter);
+    const __m256i fives = _mm256_set1_epi8('5');
+    const __m256i equals = _mm256_set1_epi8('=');
+
+    // pos + 35 <= size keeps all four loads inside the message
+    size_t pos = 0;
+    for (; pos + 32 + 3 <= size; pos += 32) {
+        const char* p = data + pos;
+        const __m256i d = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), delimiters);
+        const __m256i f1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 1)), fives);
+        const __m256i f2 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 2)), fives);
+        const __m256i e = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 3)), equals);
+        const uint32_t mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_and_si256(_mm256_and_si256(d, f1), _mm256_and_si256(f2, e))));
+        if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctz(mask)) + SYMBOL_TAG.size() + 1;
+        }
+    }
+    return find_tag_scalar(data, size, pos, delimiter);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+size_t scan_avx512(const char* data, size_t size, char delimiter) {
+    const __m512i delimiters = _mm512_set1_epi8(delimiter);
+    const __m512i fives = _mm512_set1_epi8('5');
+    const __m512i equals = _mm512_set1_epi8('=');
+
+    // Masked loads stop at the end of the message, so no scalar tail
+    for (size_t pos = 0; pos + 3 < size; pos += 64) {
+        const char* p = data + pos;
+        const size_t left = size - pos;
+        auto in_bounds = [left](size_t offset) {
+            return left - offset >= 64 ? ~__mmask64(0) : (__mmask64(1) << (left - offset)) - 1;
+        };
+        const __mmask64 d = _mm512_mask_cmpeq_epi8_mask(in_bounds(0), _mm512_maskz_loadu_epi8(in_bounds(0), p),
+                                                        delimiters);
+        const __mmask64 f1 = _mm512_mask_cmpeq_epi8_mask(d, _mm512_maskz_loadu_epi8(in_bounds(1), p + 1), fives);
+        const __mmask64 f2 = _mm512_mask_cmpeq_epi8_mask(f1, _mm512_maskz_loadu_epi8(in_bounds(2), p + 2), fives);
+        const __mmask64 e = _mm512_mask_cmpeq_epi8_mask(f2 & in_bounds(3), _mm512_maskz_loadu_epi8(in_bounds(3), p + 3),
+                                                       equals);
+        if (e != 0) {
+            return pos + static_cast<size_t>(__builtin_ctzll(e)) + SYMBOL_TAG.size() + 1;
+        }
+    }
+    return size;
+}
+
+SymbolScan select_symbol_scan(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return scan_avx512;
+        case SimdLevel::AVX2:
+            return scan_avx2;
+        case SimdLevel::SSE42:
+        case SimdLevel::Scalar:
+            break;
+    }
+    return scan_scalar;
+}
+
+template <char Delimiter>
+std::string_view symbol_at(std::string_view message, size_t start) {
+    if (start >= message.size()) {
+        return {};
+    }
+    const size_t end = message.find(Delimiter, start);
+    return message.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+}
+
+template <char Delimiter>
+std::string_view scan_symbol_with(std::string_view message, SymbolScan scan) {
+    // A message that opens with the tag has no delimiter in front of it
+    if (message.starts_with(SYMBOL_TAG)) {
+        return symbol_at<Delimiter>(message, SYMBOL_TAG.size());
+    }
+    return symbol_at<Delimiter>(message, scan(message.data(), message.size(), Delimiter));
+}
+
+} // anonymous namespace
+
+template <char Delimiter>
+std::string_view scan_symbol(std::string_view message) {
+    static const SymbolScan scan = select_symbol_scan(cpu_features().best_level());
+    return scan_symbol_with<Delimiter>(message, scan);
+}
+
+template <char Delimiter>
+std::string_view scan_symbol(std::string_view message, SimdLevel level) {
+    return scan_symbol_with<Delimiter>(message, select_symbol_scan(level));
+}
+
+uint32_t symbol_shard(std::string_view symbol, size_t shards) {
+    const size_t size = symbol.size();
+    const char* data = symbol.data();
+
+    // Two overlapping loads cover symbols of up to 16 bytes; longer ones are
+    // told apart by their first and last eight bytes and their length
+    uint64_t key;
+    if (size >= 8) {
+        key = swar::load_word(data) ^ (swar::load_word(data + size - 8) * SHARD_MULTIPLIER);
+    } else if (size >= 4) {
+        uint32_t first, last;
+        std::memcpy(&first, data, 4);
+        std::memcpy(&last, data + size - 4, 4);
+        key = first | (static_cast<uint64_t>(last) << 32);
+    } else {
+        key = 0;
+        if (size > 0) {
+            std::memcpy(&key, data, size);
+        }
+    }
+    const uint64_t hash = ((key ^ size) * SHARD_MULTIPLIER) >> 32;
+    return static_cast<uint32_t>((hash * shards) >> 32);
+}
+
+template std::string_view scan_symbol<'|'>(std::string_view);
+template std::string_view scan_symbol<SOH>(std::string_view);
+template std::string_view scan_symbol<'|'>(std::string_view, SimdLevel);
+template std::string_view scan_symbol<SOH>(std::string_view, SimdLevel);
+
+} // namespace simd_parser
@@ -1,58 +1,1293 @@
 #include "simd_utils.hpp"
+#include "swar.hpp"
 #include <immintrin.h>
 #include <cpuid.h>
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <charconv>
 
 namespace simd_parser {
 
-bool has_avx512_support() {
+namespace {
+
+/**
+ * Reads the XCR0 register to find which vector state the OS saves.
+ */
+uint64_t read_xcr0() {
+    unsigned int xcr0_lo, xcr0_hi;
+    __asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+    return (static_cast<uint64_t>(xcr0_hi) << 32) | xcr0_lo;
+}
+
+CpuFeatures detect_cpu_features() {
+    CpuFeatures features;
     unsigned int eax, ebx, ecx, edx;
 
-    // Check if CPUID is supported
-    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
-        return false;
+    // Check if CPUID is supported
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return features;
+    }
+
+    // SSE4.2 (bit 20 of ECX) needs no extra OS support beyond SSE
+    features.sse42 = (ecx & (1 << 20)) != 0;
+
+    // Check for OSXSAVE (bit 27 of ECX); without it XGETBV is unavailable
+    if (!(ecx & (1 << 27))) {
+        return features;
+    }
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return features;
+    }
+
+    const uint64_t xcr0 = read_xcr0();
+
+    // Bits 1, 2 (SSE, AVX state) must be set for AVX2
+    const bool os_supports_avx = (xcr0 & 0x6) == 0x6;
+
+    // Bits 5, 6, 7 (opmask, ZMM state) must also be set for AVX-512
+    const bool os_supports_avx512 = (xcr0 & 0xE6) == 0xE6;
+
+    features.avx2 = os_supports_avx && (ebx & (1 << 5)) != 0;
+    features.avx512f = os_supports_avx512 && (ebx & (1 << 16)) != 0;
+    features.avx512bw = os_supports_avx512 && (ebx & (1u << 30)) != 0;
+
+    // VBMI2 (bit 6 of ECX) adds byte/word compress (vpcompressb/w)
+    features.avx512vbmi2 = os_supports_avx512 && (ecx & (1 << 6)) != 0;
+
+    return features;
+}
+
+using DelimiterFinder = void (*)(std::string_view, char, std::vector<size_t>&);
+
+DelimiterFinder select_delimiter_finder() {
+    switch (cpu_features().best_level()) {
+        case SimdLevel::AVX512VBMI2:
+            return &find_delimiters_avx512_vbmi2;
+        case SimdLevel::AVX512:
+            return &find_delimiters_avx512;
+        case SimdLevel::AVX2:
+            return &find_delimiters_avx2;
+        case SimdLevel::SSE42:
+            return &find_delimiters_sse42;
+        case SimdLevel::Scalar:
+            break;
+    }
+    return &find_delimiters_scalar;
+}
+
+// ----------------------------------------------------------------------------
+// Stage-1 structural classifiers
+//
+// Each classifier writes one delimiter mask and one '=' mask per 64-byte
+// block. The final partial block is zero-padded and its masks are trimmed to
+// the input length, so callers never see bits past the end of the data.
+// Every loaded vector is also summed with SAD against zero, so the classifier
+// returns the byte sum the FIX CheckSum needs without a second pass.
+//
+// Classifiers are templated on how they receive the delimiter: a
+// RuntimeDelimiter carries it as a value, a StaticDelimiter<C> makes it a
+// compile-time constant so the broadcast folds into a constant vector.
+// ----------------------------------------------------------------------------
+
+struct RuntimeDelimiter {
+    char delimiter;
+    char value() const { return delimiter; }
+};
+
+template <char Delimiter>
+struct StaticDelimiter {
+    static constexpr char value() { return Delimiter; }
+};
+
+template <typename Delim>
+using StructuralClassifier = uint32_t (*)(const char*, size_t, Delim, uint64_t*, uint64_t*);
+
+template <typename Delim>
+uint32_t classify_scalar(const char* ptr, size_t size, Delim delimiter,
+                         uint64_t* delimiter_masks, uint64_t* equals_masks) {
+    uint32_t byte_sum = 0;
+    for (size_t block = 0; block * 64 < size; ++block) {
+        const size_t base = block * 64;
+        const size_t end = size - base < 64 ? size - base : 64;
+        uint64_t delim_bits = 0;
+        uint64_t equals_bits = 0;
+
+        for (size_t i = 0; i < end; ++i) {
+            delim_bits |= static_cast<uint64_t>(ptr[base + i] == delimiter.value()) << i;
+            equals_bits |= static_cast<uint64_t>(ptr[base + i] == '=') << i;
+            byte_sum += static_cast<uint8_t>(ptr[base + i]);
+        }
+
+        delimiter_masks[block] = delim_bits;
+        equals_masks[block] = equals_bits;
+    }
+    return byte_sum;
+}
+
+__attribute__((target("sse4.2")))
+inline uint64_t match_block_sse42(const char* ptr, __m128i needle) {
+    uint64_t mask = 0;
+    for (int lane = 0; lane < 4; ++lane) {
+        __m128i data_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + lane * 16));
+        uint64_t lane_mask = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data_vec, needle)));
+        mask |= lane_mask << (lane * 16);
+    }
+    return mask;
+}
+
+// Classifies one 64-byte block and adds its bytes to `sums` (two 64-bit lanes)
+__attribute__((target("sse4.2")))
+inline void classify_block_sse42(const char* ptr, __m128i delim_vec, __m128i equals_vec,
+                                 uint64_t& delim_mask, uint64_t& equals_mask, __m128i& sums) {
+    delim_mask = 0;
+    equals_mask = 0;
+    for (int lane = 0; lane < 4; ++lane) {
+        __m128i data_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + lane * 16));
+        uint64_t delim_lane = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data_vec, delim_vec)));
+        uint64_t equals_lane = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data_vec, equals_vec)));
+        delim_mask |= delim_lane << (lane * 16);
+        equals_mask |= equals_lane << (lane * 16);
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(data_vec, _mm_setzero_si128()));
+    }
+}
+
+__attribute__((target("sse4.2")))
+inline uint32_t reduce_sums_sse42(__m128i sums) {
+    return static_cast<uint32_t>(_mm_cvtsi128_si64(sums) + _mm_extract_epi64(sums, 1));
+}
+
+template <typename Delim>
+__attribute__((target("sse4.2")))
+uint32_t classify_sse42(const char* ptr, size_t size, Delim delimiter,
+                        uint64_t* delimiter_masks, uint64_t* equals_masks) {
+    const __m128i delim_vec = _mm_set1_epi8(delimiter.value());
+    const __m128i equals_vec = _mm_set1_epi8('=');
+    __m128i sums = _mm_setzero_si128();
+
+    size_t block = 0;
+    size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64, ++block) {
+        classify_block_sse42(ptr + pos, delim_vec, equals_vec,
+                             delimiter_masks[block], equals_masks[block], sums);
+    }
+
+    if (pos < size) {
+        // Zero padding adds nothing to the byte sum
+        alignas(64) char tail[64] = {};
+        std::memcpy(tail, ptr + pos, size - pos);
+        const uint64_t valid = (uint64_t{1} << (size - pos)) - 1;
+        classify_block_sse42(tail, delim_vec, equals_vec,
+                             delimiter_masks[block], equals_masks[block], sums);
+        delimiter_masks[block] &= valid;
+        equals_masks[block] &= valid;
+    }
+    return reduce_sums_sse42(sums);
+}
+
+__attribute__((target("avx2")))
+inline uint64_t match_block_avx2(const char* ptr, __m256i needle) {
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32));
+    uint64_t lo_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+    uint64_t hi_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+    return lo_mask | (hi_mask << 32);
+}
+
+// Classifies one 64-byte block and adds its bytes to `sums` (four 64-bit lanes)
+__attribute__((target("avx2")))
+inline void classify_block_avx2(const char* ptr, __m256i delim_vec, __m256i equals_vec,
+                                uint64_t& delim_mask, uint64_t& equals_mask, __m256i& sums) {
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32));
+    uint64_t delim_lo = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, delim_vec)));
+    uint64_t delim_hi = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, delim_vec)));
+    uint64_t equals_lo = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, equals_vec)));
+    uint64_t equals_hi = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, equals_vec)));
+    delim_mask = delim_lo | (delim_hi << 32);
+    equals_mask = equals_lo | (equals_hi << 32);
+
+    const __m256i zero = _mm256_setzero_si256();
+    sums = _mm256_add_epi64(sums, _mm256_add_epi64(_mm256_sad_epu8(lo, zero), _mm256_sad_epu8(hi, zero)));
+}
+
+__attribute__((target("avx2")))
+inline uint32_t reduce_sums_avx2(__m256i sums) {
+    __m128i half = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+    return static_cast<uint32_t>(_mm_cvtsi128_si64(half) + _mm_extract_epi64(half, 1));
+}
+
+template <typename Delim>
+__attribute__((target("avx2")))
+uint32_t classify_avx2(const char* ptr, size_t size, Delim delimiter,
+                       uint64_t* delimiter_masks, uint64_t* equals_masks) {
+    const __m256i delim_vec = _mm256_set1_epi8(delimiter.value());
+    const __m256i equals_vec = _mm256_set1_epi8('=');
+    __m256i sums = _mm256_setzero_si256();
+
+    size_t block = 0;
+    size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64, ++block) {
+        classify_block_avx2(ptr + pos, delim_vec, equals_vec,
+                            delimiter_masks[block], equals_masks[block], sums);
+    }
+
+    if (pos < size) {
+        alignas(64) char tail[64] = {};
+        std::memcpy(tail, ptr + pos, size - pos);
+        const uint64_t valid = (uint64_t{1} << (size - pos)) - 1;
+        classify_block_avx2(tail, delim_vec, equals_vec,
+                            delimiter_masks[block], equals_masks[block], sums);
+        delimiter_masks[block] &= valid;
+        equals_masks[block] &= valid;
+    }
+    return reduce_sums_avx2(sums);
+}
+
+// Spilled rather than _mm512_reduce_add_epi64, which trips GCC 12's
+// -Wuninitialized inside the intrinsic header
+__attribute__((target("avx512f,avx512bw")))
+inline uint32_t reduce_sums_avx512(__m512i sums) {
+    alignas(64) uint64_t lanes[8];
+    _mm512_store_si512(reinterpret_cast<__m512i*>(lanes), sums);
+    uint64_t total = 0;
+    for (uint64_t lane : lanes) {
+        total += lane;
+    }
+    return static_cast<uint32_t>(total);
+}
+
+template <typename Delim>
+__attribute__((target("avx512f,avx512bw")))
+uint32_t classify_avx512(const char* ptr, size_t size, Delim delimiter,
+                         uint64_t* delimiter_masks, uint64_t* equals_masks) {
+    const __m512i delim_vec = _mm512_set1_epi8(delimiter.value());
+    const __m512i equals_vec = _mm512_set1_epi8('=');
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i sums = _mm512_setzero_si512();
+
+    size_t block = 0;
+    size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64, ++block) {
+        __m512i data_vec = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr + pos));
+        delimiter_masks[block] = _mm512_cmpeq_epi8_mask(data_vec, delim_vec);
+        equals_masks[block] = _mm512_cmpeq_epi8_mask(data_vec, equals_vec);
+        sums = _mm512_add_epi64(sums, _mm512_sad_epu8(data_vec, zero));
+    }
+
+    if (pos < size) {
+        // Masked load never touches bytes past the end of the buffer
+        const __mmask64 valid = (uint64_t{1} << (size - pos)) - 1;
+        __m512i data_vec = _mm512_maskz_loadu_epi8(valid, ptr + pos);
+        delimiter_masks[block] = _mm512_mask_cmpeq_epi8_mask(valid, data_vec, delim_vec);
+        equals_masks[block] = _mm512_mask_cmpeq_epi8_mask(valid, data_vec, equals_vec);
+        sums = _mm512_add_epi64(sums, _mm512_sad_epu8(data_vec, zero));
+    }
+    return reduce_sums_avx512(sums);
+}
+
+// ----------------------------------------------------------------------------
+// Single-character match kernels
+//
+// Same block layout as the structural classifiers, but for one needle only.
+// Used by the span-based delimiter finders.
+// ----------------------------------------------------------------------------
+
+using MatchKernel = void (*)(const char*, size_t, char, uint64_t*);
+
+void match_scalar(const char* ptr, size_t size, char needle, uint64_t* masks) {
+    for (size_t block = 0; block * 64 < size; ++block) {
+        const size_t base = block * 64;
+        const size_t end = size - base < 64 ? size - base : 64;
+        uint64_t bits = 0;
+
+        for (size_t i = 0; i < end; ++i) {
+            bits |= static_cast<uint64_t>(ptr[base + i] == needle) << i;
+        }
+        masks[block] = bits;
+    }
+}
+
+__attribute__((target("sse4.2")))
+void match_sse42(const char* ptr, size_t size, char needle, uint64_t* masks) {
+    const __m128i needle_vec = _mm_set1_epi8(needle);
+
+    size_t block = 0;
+    size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64, ++block) {
+        masks[block] = match_block_sse42(ptr + pos, needle_vec);
+    }
+
+    if (pos < size) {
+        alignas(64) char tail[64] = {};
+        std::memcpy(tail, ptr + pos, size - pos);
+        masks[block] = match_block_sse42(tail, needle_vec) & ((uint64_t{1} << (size - pos)) - 1);
+    }
+}
+
+__attribute__((target("avx2")))
+void match_avx2(const char* ptr, size_t size, char needle, uint64_t* masks) {
+    const __m256i needle_vec = _mm256_set1_epi8(needle);
+
+    size_t block = 0;
+    size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64, ++block) {
+        masks[block] = match_block_avx2(ptr + pos, needle_vec);
+    }
+
+    if (pos < size) {
+        alignas(64) char tail[64] = {};
+        std::memcpy(tail, ptr + pos, size - pos);
+        masks[block] = match_block_avx2(tail, needle_vec) & ((uint64_t{1} << (size - pos)) - 1);
+    }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void match_avx512(const char* ptr, size_t size, char needle, uint64_t* masks) {
+    const __m512i needle_vec = _mm512_set1_epi8(needle);
+
+    size_t block = 0;
+    size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64, ++block) {
+        __m512i data_vec = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr + pos));
+        masks[block] = _mm512_cmpeq_epi8_mask(data_vec, needle_vec);
+    }
+
+    if (pos < size) {
+        const __mmask64 valid = (uint64_t{1} << (size - pos)) - 1;
+        __m512i data_vec = _mm512_maskz_loadu_epi8(valid, ptr + pos);
+        masks[block] = _mm512_mask_cmpeq_epi8_mask(valid, data_vec, needle_vec);
+    }
+}
+
+MatchKernel select_match_kernel(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return match_avx512;
+        case SimdLevel::AVX2:
+            return match_avx2;
+        case SimdLevel::SSE42:
+            return match_sse42;
+        case SimdLevel::Scalar:
+            break;
+    }
+    return match_scalar;
+}
+
+// ----------------------------------------------------------------------------
+// Byte sum kernels
+//
+// Sum every byte of a buffer with SAD against zero. Used by
+// compute_checksum_simd(); the parsers get the same sum from the structural
+// classifiers instead.
+// ----------------------------------------------------------------------------
+
+using ByteSumKernel = uint32_t (*)(const char*, size_t);
+
+uint32_t byte_sum_scalar(const char* ptr, size_t size) {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+        sum += static_cast<uint8_t>(ptr[i]);
+    }
+    return sum;
+}
+
+__attribute__((target("sse4.2")))
+uint32_t byte_sum_sse42(const char* ptr, size_t size) {
+    __m128i sums = _mm_setzero_si128();
+
+    size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16) {
+        __m128i data_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + pos));
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(data_vec, _mm_setzero_si128()));
+    }
+    return reduce_sums_sse42(sums) + byte_sum_scalar(ptr + pos, size - pos);
+}
+
+__attribute__((target("avx2")))
+uint32_t byte_sum_avx2(const char* ptr, size_t size) {
+    __m256i sums = _mm256_setzero_si256();
+
+    size_t pos = 0;
+    for (; pos + 32 <= size; pos += 32) {
+        __m256i data_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + pos));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(data_vec, _mm256_setzero_si256()));
+    }
+    return reduce_sums_avx2(sums) + byte_sum_scalar(ptr + pos, size - pos);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+uint32_t byte_sum_avx512(const char* ptr, size_t size) {
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i sums = _mm512_setzero_si512();
+
+    size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64) {
+        __m512i data_vec = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr + pos));
+        sums = _mm512_add_epi64(sums, _mm512_sad_epu8(data_vec, zero));
+    }
+
+    if (pos < size) {
+        const __mmask64 valid = (uint64_t{1} << (size - pos)) - 1;
+        __m512i data_vec = _mm512_maskz_loadu_epi8(valid, ptr + pos);
+        sums = _mm512_add_epi64(sums, _mm512_sad_epu8(data_vec, zero));
+    }
+    return reduce_sums_avx512(sums);
+}
+
+ByteSumKernel select_byte_sum_kernel(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return byte_sum_avx512;
+        case SimdLevel::AVX2:
+            return byte_sum_avx2;
+        case SimdLevel::SSE42:
+            return byte_sum_sse42;
+        case SimdLevel::Scalar:
+            break;
+    }
+    return byte_sum_scalar;
+}
+
+/**
+ * Writes delimiter positions into a caller buffer.
+ * Matches are found in chunks of CHUNK_BLOCKS 64-byte blocks so the mask
+ * scratch stays on the stack. Once `out` is full, remaining matches are only
+ * counted (popcount per block) so the caller learns the required size.
+ */
+template <typename Position>
+size_t find_delimiters_into(std::string_view data, char delimiter, std::span<Position> out,
+                            MatchKernel match) {
+    constexpr size_t CHUNK_BLOCKS = 16;
+    constexpr size_t CHUNK_SIZE = CHUNK_BLOCKS * 64;
+    uint64_t masks[CHUNK_BLOCKS];
+
+    Position* dest = out.data();
+    const size_t capacity = out.size();
+    size_t count = 0;
+
+    for (size_t chunk = 0; chunk < data.size(); chunk += CHUNK_SIZE) {
+        const size_t chunk_size = std::min(CHUNK_SIZE, data.size() - chunk);
+        match(data.data() + chunk, chunk_size, delimiter, masks);
+
+        const size_t blocks = (chunk_size + 63) / 64;
+        for (size_t block = 0; block < blocks; ++block) {
+            uint64_t mask = masks[block];
+            const size_t matches = __builtin_popcountll(mask);
+            const size_t base = chunk + block * 64;
+
+            if (count + matches <= capacity) {
+                while (mask != 0) {
+                    dest[count++] = static_cast<Position>(base + __builtin_ctzll(mask));
+                    mask &= mask - 1;
+                }
+            } else {
+                // Overflow: fill what fits, then keep counting
+                while (mask != 0 && count < capacity) {
+                    dest[count++] = static_cast<Position>(base + __builtin_ctzll(mask));
+                    mask &= mask - 1;
+                }
+                count += __builtin_popcountll(mask);
+            }
+        }
+    }
+
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// AVX-512 VBMI2 position extraction
+//
+// vpcompressb packs the lane indices selected by a block's match mask into the
+// low bytes of a vector, so all match offsets of a 64-byte block come out of
+// one instruction instead of one ctz each. The offsets are widened to the
+// output position type, rebased and written with masked stores (one per 32,
+// 16 or 8 positions), so nothing is written past the last match.
+// ----------------------------------------------------------------------------
+
+constexpr std::array<uint8_t, 64> make_lane_index() {
+    std::array<uint8_t, 64> index{};
+    for (size_t i = 0; i < index.size(); ++i) {
+        index[i] = static_cast<uint8_t>(i);
+    }
+    return index;
+}
+
+alignas(64) constexpr std::array<uint8_t, 64> LANE_INDEX = make_lane_index();
+
+// Mask selecting the first `count` lanes (all lanes if count >= 64)
+inline uint64_t first_lanes(size_t count) {
+    return count >= 64 ? ~uint64_t{0} : (uint64_t{1} << count) - 1;
+}
+
+template <typename Position>
+__attribute__((target("avx512f,avx512bw,avx512vbmi2")))
+inline void store_block_positions(Position* dest, uint64_t mask, size_t base) {
+    const __m512i lane_index = _mm512_load_si512(LANE_INDEX.data());
+    // 16-byte loads below may read up to 8 bytes past the 64 offsets
+    alignas(64) uint8_t offsets[80];
+    _mm512_store_si512(offsets, _mm512_maskz_compress_epi8(mask, lane_index));
+    const size_t count = __builtin_popcountll(mask);
+
+    // maskz widening sidesteps GCC 12's -Wmaybe-uninitialized in the plain
+    // cvtepu8 intrinsics, and the 64-bit path loads 16 bytes because a
+    // 64-bit loadl feeding vpmovzxbq ICEs GCC 12; the lane mask drives the store
+    if constexpr (sizeof(Position) == 2) {
+        const __m512i base_vec = _mm512_set1_epi16(static_cast<int16_t>(base));
+        for (size_t i = 0; i < count; i += 32) {
+            const __mmask32 lanes = static_cast<__mmask32>(first_lanes(count - i));
+            __m512i wide = _mm512_maskz_cvtepu8_epi16(lanes, _mm256_load_si256(reinterpret_cast<const __m256i*>(offsets + i)));
+            _mm512_mask_storeu_epi16(dest + i, lanes, _mm512_add_epi16(wide, base_vec));
+        }
+    } else if constexpr (sizeof(Position) == 4) {
+        const __m512i base_vec = _mm512_set1_epi32(static_cast<int32_t>(base));
+        for (size_t i = 0; i < count; i += 16) {
+            const __mmask16 lanes = static_cast<__mmask16>(first_lanes(count - i));
+            __m512i wide = _mm512_maskz_cvtepu8_epi32(lanes, _mm_load_si128(reinterpret_cast<const __m128i*>(offsets + i)));
+            _mm512_mask_storeu_epi32(dest + i, lanes, _mm512_add_epi32(wide, base_vec));
+        }
+    } else {
+        static_assert(sizeof(Position) == 8, "Positions are 16, 32 or 64 bits");
+        const __m512i base_vec = _mm512_set1_epi64(static_cast<int64_t>(base));
+        for (size_t i = 0; i < count; i += 8) {
+            const __mmask8 lanes = static_cast<__mmask8>(first_lanes(count - i));
+            __m512i wide = _mm512_maskz_cvtepu8_epi64(lanes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(offsets + i)));
+            _mm512_mask_storeu_epi64(dest + i, lanes, _mm512_add_epi64(wide, base_vec));
+        }
+    }
+}
+
+/**
+ * VBMI2 counterpart of find_delimiters_into(): same overflow semantics, but
+ * compares inline (no mask scratch) and extracts whole blocks by compress.
+ */
+template <typename Position>
+__attribute__((target("avx512f,avx512bw,avx512vbmi2")))
+size_t find_delimiters_into_vbmi2(std::string_view data, char delimiter, std::span<Position> out) {
+    const __m512i delim_vec = _mm512_set1_epi8(delimiter);
+
+    Position* dest = out.data();
+    const size_t capacity = out.size();
+    size_t count = 0;
+
+    for (size_t pos = 0; pos < data.size(); pos += 64) {
+        // Masked load never touches bytes past the end of the buffer
+        const __mmask64 valid = first_lanes(data.size() - pos);
+        __m512i data_vec = _mm512_maskz_loadu_epi8(valid, data.data() + pos);
+        uint64_t mask = _mm512_mask_cmpeq_epi8_mask(valid, data_vec, delim_vec);
+        const size_t matches = __builtin_popcountll(mask);
+
+        if (count + matches <= capacity) {
+            if (mask != 0) {
+                store_block_positions(dest + count, mask, pos);
+            }
+            count += matches;
+        } else {
+            // Overflow: fill what fits, then keep counting
+            while (mask != 0 && count < capacity) {
+                dest[count++] = static_cast<Position>(pos + __builtin_ctzll(mask));
+                mask &= mask - 1;
+            }
+            count += __builtin_popcountll(mask);
+        }
+    }
+
+    return count;
+}
+
+template <typename Position>
+using SpanFinder = size_t (*)(std::string_view, char, std::span<Position>);
+
+template <typename Position>
+size_t find_delimiters_into_avx512(std::string_view data, char delimiter, std::span<Position> out) {
+    return find_delimiters_into(data, delimiter, out, match_avx512);
+}
+
+template <typename Position>
+size_t find_delimiters_into_avx2(std::string_view data, char delimiter, std::span<Position> out) {
+    return find_delimiters_into(data, delimiter, out, match_avx2);
+}
+
+template <typename Position>
+size_t find_delimiters_into_sse42(std::string_view data, char delimiter, std::span<Position> out) {
+    return find_delimiters_into(data, delimiter, out, match_sse42);
+}
+
+template <typename Position>
+size_t find_delimiters_into_scalar(std::string_view data, char delimiter, std::span<Position> out) {
+    return find_delimiters_into(data, delimiter, out, match_scalar);
+}
+
+template <typename Position>
+SpanFinder<Position> select_span_finder(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+            return find_delimiters_into_vbmi2<Position>;
+        case SimdLevel::AVX512:
+            return find_delimiters_into_avx512<Position>;
+        case SimdLevel::AVX2:
+            return find_delimiters_into_avx2<Position>;
+        case SimdLevel::SSE42:
+            return find_delimiters_into_sse42<Position>;
+        case SimdLevel::Scalar:
+            break;
+    }
+    return find_delimiters_into_scalar<Position>;
+}
+
+template <typename Delim>
+StructuralClassifier<Delim> select_structural_classifier(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return classify_avx512<Delim>;
+        case SimdLevel::AVX2:
+            return classify_avx2<Delim>;
+        case SimdLevel::SSE42:
+            return classify_sse42<Delim>;
+        case SimdLevel::Scalar:
+            break;
+    }
+    return classify_scalar<Delim>;
+}
+
+template <typename Delim>
+void run_structural_classifier(StructuralClassifier<Delim> classify, std::string_view data,
+                               Delim delimiter, StructuralIndex& index) {
+    index.length = data.size();
+    index.delimiter_masks.resize(index.block_count());
+    index.equals_masks.resize(index.block_count());
+
+    index.byte_sum = classify(data.data(), data.size(), delimiter,
+                              index.delimiter_masks.data(), index.equals_masks.data());
+}
+
+// ----------------------------------------------------------------------------
+// 16-digit integer kernels
+//
+// The AVX-512 kernel right-aligns the digits in one 16-byte lane with a masked
+// load (masked-off bytes are never read, so the load cannot fault before the
+// run), then folds them like the SWAR kernel: maddubs makes 2-digit values,
+// madd 4-digit, packus + madd 8-digit, and the two halves combine in a
+// scalar multiply-add.
+// ----------------------------------------------------------------------------
+
+using DigitKernel = bool (*)(const char*, size_t, uint64_t&);
+
+bool digits16_swar(const char* data, size_t count, uint64_t& value) {
+    value = 0;
+    return swar::accumulate_digits(std::string_view(data, count), 0, count, value);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+bool digits16_avx512(const char* data, size_t count, uint64_t& value) {
+    const __mmask64 lanes = ((uint64_t{1} << count) - 1) << (16 - count);
+    const __m512i bytes = _mm512_maskz_loadu_epi8(lanes, data + count - 16);
+    const __m512i digits = _mm512_maskz_sub_epi8(lanes, bytes, _mm512_set1_epi8('0'));
+    if (_mm512_mask_cmpgt_epu8_mask(lanes, digits, _mm512_set1_epi8(9)) != 0) {
+        return false;
+    }
+
+    // 512-bit forms throughout (only the low 16 lanes carry digits): GCC 12
+    // warns about the undefined upper half in 128-bit casts and extracts
+    __m512i v = _mm512_maddubs_epi16(digits, _mm512_set1_epi16(0x010A));
+    v = _mm512_madd_epi16(v, _mm512_set1_epi32(0x00010064));
+    v = _mm512_packus_epi32(v, v);
+    v = _mm512_madd_epi16(v, _mm512_set1_epi32(0x00012710));
+
+    const __m512i low_half = _mm512_maskz_alignr_epi32(0x1, v, v, 1);
+    value = static_cast<uint64_t>(_mm512_cvtsi512_si32(v)) * 100000000 +
+            static_cast<uint32_t>(_mm512_cvtsi512_si32(low_half));
+    return true;
+}
+
+DigitKernel select_digit_kernel(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return digits16_avx512;
+        case SimdLevel::AVX2:
+        case SimdLevel::SSE42:
+        case SimdLevel::Scalar:
+            break;
+    }
+    return digits16_swar;
+}
+
+// ----------------------------------------------------------------------------
+// Batched numeric conversion
+//
+// Each value is packed right-aligned and '0'-padded, without sign or point:
+// integers of up to eight digits into one word per lane, prices of up to 16
+// digits into a 16-byte slot per lane. The AVX-512 kernels then validate and
+// combine eight lanes per vector, and for prices convert and divide by the
+// power of ten eight lanes at a time. Values that do not fit (longer runs,
+// exponents, stray bytes) are flagged and converted by the scalar functions
+// afterwards, so results always match parse_int() and
+// parse_price(). All-ones maskz forms stand in for intrinsics whose unmasked
+// GCC 12 versions trip -Wmaybe-uninitialized.
+// ----------------------------------------------------------------------------
+
+constexpr size_t BATCH_LANES = 8;
+
+using IntBatchKernel = void (*)(const std::string_view*, size_t, int32_t*);
+using PriceBatchKernel = void (*)(const std::string_view*, size_t, double*, Decimal64*);
+
+/**
+ * Packs an optionally negative run of one to eight digits into a word.
+ *
+ * @return false if the value needs the scalar path
+ */
+inline bool pack_int(std::string_view str, uint64_t& word, bool& negative) {
+    negative = !str.empty() && str[0] == '-';
+    const size_t begin = negative ? 1 : 0;
+    const size_t digits = str.size() - begin;
+    if (digits - 1 >= 8) {
+        return false;
+    }
+    word = swar::load_digits(str, begin, digits);
+    return true;
+}
+
+void int_batch_scalar(const std::string_view* values, size_t count, int32_t* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = parse_int(values[i]);
+    }
+}
+
+void price_batch_scalar(const std::string_view* values, size_t count, double* prices,
+                        Decimal64* decimals) {
+    for (size_t i = 0; i < count; ++i) {
+        prices[i] = parse_price(values[i], decimals[i]);
+    }
+}
+
+/**
+ * Combines eight digit values per 64-bit lane (most significant in the low
+ * byte, each 0..9) into one number per lane, 0..99999999.
+ */
+__attribute__((target("avx512f,avx512bw")))
+inline __m512i combine_digits_avx512(__m512i digits) {
+    // 2-digit u16s, then 4-digit u32s: the low dword of each lane holds the
+    // leading four digits, the high dword the trailing four
+    __m512i v = _mm512_maddubs_epi16(digits, _mm512_set1_epi16(0x010A));
+    v = _mm512_madd_epi16(v, _mm512_set1_epi32(0x00010064));
+    return _mm512_add_epi64(_mm512_maskz_mul_epu32(0xFF, v, _mm512_set1_epi64(10000)),
+                            _mm512_maskz_srli_epi64(0xFF, v, 32));
+}
+
+/**
+ * @return All-ones in every byte of digits that is not a digit value
+ */
+__attribute__((target("avx512f,avx512bw")))
+inline __m512i non_digits_avx512(__m512i digits) {
+    return _mm512_movm_epi8(_mm512_cmpgt_epu8_mask(digits, _mm512_set1_epi8(9)));
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void int_batch_avx512(const std::string_view* values, size_t count, int32_t* out) {
+    size_t i = 0;
+    for (; i + BATCH_LANES <= count; i += BATCH_LANES) {
+        alignas(64) uint64_t words[BATCH_LANES];
+        __mmask8 scalar = 0;
+        __mmask8 negative = 0;
+        for (size_t lane = 0; lane < BATCH_LANES; ++lane) {
+            bool is_negative = false;
+            if (!pack_int(values[i + lane], words[lane], is_negative)) {
+                words[lane] = swar::ASCII_ZEROS;
+                scalar |= static_cast<__mmask8>(1u << lane);
+            }
+            negative |= static_cast<__mmask8>(is_negative ? 1u << lane : 0u);
+        }
+
+        const __m512i digits = _mm512_sub_epi8(_mm512_load_si512(words), _mm512_set1_epi8('0'));
+        const __m512i bad = non_digits_avx512(digits);
+        const __mmask8 invalid = _mm512_test_epi64_mask(bad, bad);
+        __m512i v = combine_digits_avx512(digits);
+        v = _mm512_mask_sub_epi64(v, negative, _mm512_setzero_si512(), v);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm512_maskz_cvtepi64_epi32(0xFF, v));
+
+        for (uint32_t redo = scalar | invalid; redo != 0; redo &= redo - 1) {
+            const size_t lane = static_cast<size_t>(__builtin_ctz(redo));
+            out[i + lane] = parse_int(values[i + lane]);
+        }
+    }
+    int_batch_scalar(values + i, count - i, out + i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void price_batch_avx512(const std::string_view* values, size_t count, double* prices,
+                        Decimal64* decimals) {
+    constexpr size_t SLOT = 16;
+    const __m512i ascii_zeros = _mm512_set1_epi8('0');
+    const __m512i even_words = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m512i odd_words = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+    const __m512d low_powers = _mm512_setr_pd(1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7);
+    const __m512d high_powers = _mm512_setr_pd(1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15);
+
+    // Below 2^52, or-ing in the exponent of 2^52 and subtracting 2^52
+    // converts uint64 -> double exactly without AVX512DQ
+    const __m512i exact_limit = _mm512_set1_epi64(int64_t{1} << 52);
+    const __m512i magic_bits = _mm512_set1_epi64(0x4330000000000000);
+    const __m512d magic = _mm512_castsi512_pd(magic_bits);
+
+    // One 16-digit slot per lane; the slack in front keeps every masked
+    // store address inside the buffer
+    alignas(64) char buffer[64 + BATCH_LANES * SLOT];
+    char* const slots = buffer + 64;
+
+    size_t i = 0;
+    for (; i + BATCH_LANES <= count; i += BATCH_LANES) {
+        _mm512_store_si512(slots, ascii_zeros);
+        _mm512_store_si512(slots + 64, ascii_zeros);
+
+        // Right-align each mantissa in its slot with masked stores, dropping
+        // the point: "-150.25" leaves '0'-padded "15025" and 2 fraction digits
+        alignas(64) uint64_t fraction_digits[BATCH_LANES];
+        __mmask8 scalar = 0;
+        __mmask8 negative = 0;
+        for (size_t lane = 0; lane < BATCH_LANES; ++lane) {
+            std::string_view str = values[i + lane];
+            const __mmask8 bit = static_cast<__mmask8>(1u << lane);
+            fraction_digits[lane] = 0;
+            if (!str.empty() && str[0] == '-') {
+                negative |= bit;
+                str.remove_prefix(1);
+            }
+            if (str.empty() || str.size() > SLOT + 1) {
+                scalar |= bit;
+                continue;
+            }
+
+            const __mmask64 bytes = (uint64_t{1} << str.size()) - 1;
+            const __m512i chars = _mm512_maskz_loadu_epi8(bytes, str.data());
+            const __mmask64 dots = _mm512_mask_cmpeq_epi8_mask(bytes, chars, _mm512_set1_epi8('.'));
+            const size_t integer = dots != 0 ? static_cast<size_t>(__builtin_ctzll(dots)) : str.size();
+            const size_t fraction = dots != 0 ? str.size() - integer - 1 : 0;
+            if (integer == 0 || (dots != 0 && fraction == 0) || integer + fraction > SLOT) {
+                scalar |= bit;
+                continue;
+            }
+
+            char* const slot_end = slots + (lane + 1) * SLOT;
+            _mm512_mask_storeu_epi8(slot_end - fraction - integer, (uint64_t{1} << integer) - 1, chars);
+            if (fraction != 0) {
+                _mm512_mask_storeu_epi8(slot_end - fraction - integer - 1,
+                                        ((uint64_t{1} << fraction) - 1) << (integer + 1), chars);
+            }
+            fraction_digits[lane] = fraction;
+        }
+
+        // Each slot is two words: leading and trailing eight digits
+        const __m512i digits_a = _mm512_sub_epi8(_mm512_load_si512(slots), ascii_zeros);
+        const __m512i digits_b = _mm512_sub_epi8(_mm512_load_si512(slots + 64), ascii_zeros);
+        const __m512i words_a = combine_digits_avx512(digits_a);
+        const __m512i words_b = combine_digits_avx512(digits_b);
+        const __m512i high = _mm512_permutex2var_epi64(words_a, even_words, words_b);
+        const __m512i low = _mm512_permutex2var_epi64(words_a, odd_words, words_b);
+        const __m512i magnitudes =
+            _mm512_add_epi64(_mm512_maskz_mul_epu32(0xFF, high, _mm512_set1_epi64(100000000)), low);
+
+        const __m512i bad_a = non_digits_avx512(digits_a);
+        const __m512i bad_b = non_digits_avx512(digits_b);
+        const __m512i bad = _mm512_or_si512(_mm512_permutex2var_epi64(bad_a, even_words, bad_b),
+                                            _mm512_permutex2var_epi64(bad_a, odd_words, bad_b));
+        const __mmask8 invalid =
+            _mm512_test_epi64_mask(bad, bad) | _mm512_cmpge_epu64_mask(magnitudes, exact_limit);
+
+        const __m512i fractions = _mm512_load_si512(fraction_digits);
+        const __m512d divisors =
+            _mm512_maskz_permutex2var_pd(0xFF, low_powers, fractions, high_powers);
+        __m512d values_pd = _mm512_sub_pd(
+            _mm512_castsi512_pd(_mm512_or_si512(magnitudes, magic_bits)), magic);
+        values_pd = _mm512_div_pd(values_pd, divisors);
+        values_pd = _mm512_mask_sub_pd(values_pd, negative, _mm512_setzero_pd(), values_pd);
+        _mm512_storeu_pd(prices + i, values_pd);
+
+        alignas(64) int64_t mantissas[BATCH_LANES];
+        _mm512_store_si512(mantissas, _mm512_mask_sub_epi64(magnitudes, negative,
+                                                            _mm512_setzero_si512(), magnitudes));
+        for (size_t lane = 0; lane < BATCH_LANES; ++lane) {
+            decimals[i + lane] = {mantissas[lane], -static_cast<int32_t>(fraction_digits[lane])};
+        }
+
+        for (uint32_t redo = scalar | invalid; redo != 0; redo &= redo - 1) {
+            const size_t lane = static_cast<size_t>(__builtin_ctz(redo));
+            prices[i + lane] = parse_price(values[i + lane], decimals[i + lane]);
+        }
+    }
+    price_batch_scalar(values + i, count - i, prices + i, decimals + i);
+}
+
+IntBatchKernel select_int_batch_kernel(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return int_batch_avx512;
+        case SimdLevel::AVX2:
+        case SimdLevel::SSE42:
+        case SimdLevel::Scalar:
+            break;
+    }
+    return int_batch_scalar;
+}
+
+PriceBatchKernel select_price_batch_kernel(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return price_batch_avx512;
+        case SimdLevel::AVX2:
+        case SimdLevel::SSE42:
+        case SimdLevel::Scalar:
+            break;
+    }
+    return price_batch_scalar;
+}
+
+// ----------------------------------------------------------------------------
+// UTCTimestamp conversion
+//
+// "YYYYMMDD-HH:MM:SS[.f...]" has a fixed layout, so the SSE4.2 kernel checks
+// all separators and digits of the first 16 bytes with two compares, packs
+// the 14 date-time digits into aligned pairs with one pshufb and folds them
+// into year/month/day/hour/minute/second with one maddubs. The fraction goes
+// through the SWAR kernel.
+// ----------------------------------------------------------------------------
+
+using TimestampParser = bool (*)(std::string_view, int64_t&);
+
+constexpr int64_t NANOS_PER_SECOND = 1000000000;
+constexpr size_t TIMESTAMP_SECONDS_LENGTH = 17;  // Up to and including SS
+
+/**
+ * Days since 1970-01-01 of a proleptic Gregorian date (H. Hinnant's
+ * days_from_civil).
+ */
+constexpr int64_t days_from_civil(int64_t year, uint32_t month, uint32_t day) {
+    year -= month <= 2 ? 1 : 0;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const uint32_t year_of_era = static_cast<uint32_t>(year - era * 400);
+    const uint32_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const uint32_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+}
+
+constexpr uint32_t days_in_month(uint32_t year, uint32_t month) {
+    constexpr uint8_t DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return month == 2 && leap ? 29 : DAYS[month - 1];
+}
+
+/**
+ * Range-checks the fields and combines them. A leap second (60) is
+ * accepted and counts into the next minute.
+ *
+ * @return false if a field is out of range or the result overflows int64_t
+ */
+bool combine_timestamp(uint32_t year, uint32_t month, uint32_t day, uint32_t hour, uint32_t minute,
+                       uint32_t second, int64_t fraction_nanos, int64_t& nanos) {
+    if (month - 1 >= 12 || day - 1 >= days_in_month(year, month) || hour > 23 || minute > 59 ||
+        second > 60) {
+        return false;
+    }
+    const int64_t seconds = days_from_civil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    int64_t result;
+    if (__builtin_mul_overflow(seconds, NANOS_PER_SECOND, &result) ||
+        __builtin_add_overflow(result, fraction_nanos, &result)) {
+        return false;
+    }
+    nanos = result;
+    return true;
+}
+
+/**
+ * Checks the length and the '.' and converts the optional fraction.
+ *
+ * @return false if the fraction is malformed
+ */
+inline bool timestamp_fraction(std::string_view str, int64_t& fraction_nanos) {
+    fraction_nanos = 0;
+    if (str.size() == TIMESTAMP_SECONDS_LENGTH) {
+        return true;
+    }
+    if (str[TIMESTAMP_SECONDS_LENGTH] != '.' || str.size() == TIMESTAMP_SECONDS_LENGTH + 1) {
+        return false;
+    }
+
+    const size_t digits = str.size() - TIMESTAMP_SECONDS_LENGTH - 1;
+    uint64_t value = 0;
+    if (!swar::accumulate_digits(str, TIMESTAMP_SECONDS_LENGTH + 1, digits, value)) {
+        return false;
+    }
+    fraction_nanos = static_cast<int64_t>(value * swar::DIGIT_SCALE[9 - digits]);
+    return true;
+}
+
+__attribute__((target("sse4.2")))
+bool parse_timestamp_sse42(std::string_view str, int64_t& nanos) {
+    if (str.size() < MIN_TIMESTAMP_LENGTH || str.size() > MAX_TIMESTAMP_LENGTH) {
+        return false;
+    }
+
+    // Bytes 0..15 ("YYYYMMDD-HH:MM:S"): separators where expected, digits elsewhere
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data()));
+    const __m128i digits = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+    const __m128i is_separator = _mm_cmpeq_epi8(
+        bytes, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, ':', 0, 0, ':', 0));
+    const __m128i separator_lanes =
+        _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const uint32_t last_digit = static_cast<uint8_t>(str[16] - '0');
+    if (_mm_movemask_epi8(_mm_blendv_epi8(is_digit, is_separator, separator_lanes)) != 0xFFFF ||
+        last_digit > 9) {
+        return false;
+    }
+
+    // YYYYMMDDHHMMSS as aligned digit pairs, then one 2-digit value per u16
+    __m128i packed = _mm_shuffle_epi8(
+        digits, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 12, 13, 15, -1, -1, -1));
+    packed = _mm_insert_epi8(packed, static_cast<int>(last_digit), 13);
+    const __m128i pairs = _mm_maddubs_epi16(packed, _mm_set1_epi16(0x010A));
+
+    int64_t fraction_nanos;
+    if (!timestamp_fraction(str, fraction_nanos)) {
+        return false;
+    }
+    const uint32_t year = static_cast<uint32_t>(_mm_extract_epi16(pairs, 0) * 100 + _mm_extract_epi16(pairs, 1));
+    return combine_timestamp(year, _mm_extract_epi16(pairs, 2), _mm_extract_epi16(pairs, 3),
+                             _mm_extract_epi16(pairs, 4), _mm_extract_epi16(pairs, 5),
+                             _mm_extract_epi16(pairs, 6), fraction_nanos, nanos);
+}
+
+TimestampParser select_timestamp_parser(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+        case SimdLevel::AVX2:
+        case SimdLevel::SSE42:
+            return parse_timestamp_sse42;
+        case SimdLevel::Scalar:
+            break;
+    }
+    return parse_timestamp_scalar;
+}
+
+/**
+ * parse_double() for values the Decimal64 fast path cannot convert exactly
+ * (exponent notation, long mantissas, malformed input).
+ */
+double parse_double_chars(std::string_view str) {
+    double result = 0.0;
+
+    // Try std::from_chars first (C++17, but may not be available for double)
+    #ifdef __cpp_lib_to_chars
+    auto [ptr, ec] = std::from_chars(
+        str.data(),
+        str.data() + str.size(),
+        result
+    );
+
+    if (ec == std::errc()) {
+        return result;
+    }
+    #endif
+
+    // Manual parsing for typical FIX prices (e.g., "150.25")
+    bool negative = false;
+    size_t i = 0;
+
+    if (!str.empty() && str[0] == '-') {
+        negative = true;
+        i = 1;
     }
 
-    // Check for OSXSAVE (bit 27 of ECX)
-    if (!(ecx & (1 << 27))) {
-        return false;
+    // Parse integer part
+    double integer_part = 0.0;
+    for (; i < str.size() && str[i] != '.'; ++i) {
+        if (str[i] >= '0' && str[i] <= '9') {
+            integer_part = integer_part * 10.0 + (str[i] - '0');
+        }
     }
 
-    // Check for AVX512F support (bit 16 of EBX in leaf 7)
-    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
-        return false;
+    // Parse fractional part
+    double fractional_part = 0.0;
+    if (i < str.size() && str[i] == '.') {
+        ++i;
+        double divisor = 10.0;
+        for (; i < str.size(); ++i) {
+            if (str[i] >= '0' && str[i] <= '9') {
+                fractional_part += (str[i] - '0') / divisor;
+                divisor *= 10.0;
+            } else {
+                break;
+            }
+        }
     }
 
-    bool has_avx512f = (ebx & (1 << 16)) != 0;
-    bool has_avx512bw = (ebx & (1 << 30)) != 0;
+    result = integer_part + fractional_part;
+    return negative ? -result : result;
+}
 
-    // Check if OS has enabled AVX-512 state saving
-    unsigned int xcr0_lo, xcr0_hi;
-    __asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+} // anonymous namespace
 
-    // Bits 5, 6, 7 must be set for AVX-512
-    bool os_supports_avx512 = (xcr0_lo & 0xE6) == 0xE6;
+SimdLevel CpuFeatures::best_level() const {
+    if (avx512f && avx512bw) {
+        return avx512vbmi2 ? SimdLevel::AVX512VBMI2 : SimdLevel::AVX512;
+    }
+    if (avx2) {
+        return SimdLevel::AVX2;
+    }
+    if (sse42) {
+        return SimdLevel::SSE42;
+    }
+    return SimdLevel::Scalar;
+}
 
-    return has_avx512f && has_avx512bw && os_supports_avx512;
+const CpuFeatures& cpu_features() {
+    static const CpuFeatures features = detect_cpu_features();
+    return features;
 }
 
-std::vector<size_t> find_delimiters_scalar(std::string_view data, char delimiter) {
-    std::vector<size_t> positions;
-    positions.reserve(data.size() / 10);  // Heuristic: assume ~10 chars per field
+const char* simd_level_name(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+            return "AVX-512 VBMI2";
+        case SimdLevel::AVX512:
+            return "AVX-512";
+        case SimdLevel::AVX2:
+            return "AVX2";
+        case SimdLevel::SSE42:
+            return "SSE4.2";
+        case SimdLevel::Scalar:
+            break;
+    }
+    return "Scalar";
+}
+
+bool has_avx512_support() {
+    const CpuFeatures& features = cpu_features();
+    return features.avx512f && features.avx512bw;
+}
+
+void find_delimiters_scalar(std::string_view data, char delimiter,
+                            std::vector<size_t>& positions) {
+    // Reuse the caller's capacity; steady-state calls do not allocate
+    positions.clear();
 
     for (size_t i = 0; i < data.size(); ++i) {
         if (data[i] == delimiter) {
             positions.push_back(i);
         }
     }
+}
 
+std::vector<size_t> find_delimiters_scalar(std::string_view data, char delimiter) {
+    std::vector<size_t> positions;
+    positions.reserve(data.size() / 10);  // Heuristic: assume ~10 chars per field
+    find_delimiters_scalar(data, delimiter, positions);
     return positions;
 }
 
-std::vector<size_t> find_delimiters_simd(std::string_view data, char delimiter) {
+__attribute__((target("sse4.2")))
+void find_delimiters_sse42(std::string_view data, char delimiter,
+                           std::vector<size_t>& positions) {
+    positions.clear();
+
+    const char* ptr = data.data();
+    const size_t size = data.size();
+    size_t pos = 0;
+
+    // Process 16 bytes at a time using SSE
+    constexpr size_t SIMD_WIDTH = 16;
+    const size_t simd_end = size - (size % SIMD_WIDTH);
+
+    const __m128i delim_vec = _mm_set1_epi8(delimiter);
+
+    for (; pos < simd_end; pos += SIMD_WIDTH) {
+        __m128i data_vec = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(ptr + pos)
+        );
+
+        // movemask packs the top bit of each compared byte into a 16-bit mask
+        uint32_t match_mask = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(data_vec, delim_vec))
+        );
+
+        while (match_mask != 0) {
+            unsigned int bit_pos = __builtin_ctz(match_mask);
+            positions.push_back(pos + bit_pos);
+            match_mask &= (match_mask - 1);
+        }
+    }
+
+    for (; pos < size; ++pos) {
+        if (ptr[pos] == delimiter) {
+            positions.push_back(pos);
+        }
+    }
+}
+
+std::vector<size_t> find_delimiters_sse42(std::string_view data, char delimiter) {
+    std::vector<size_t> positions;
+    positions.reserve(data.size() / 10);
+    find_delimiters_sse42(data, delimiter, positions);
+    return positions;
+}
+
+__attribute__((target("avx2")))
+void find_delimiters_avx2(std::string_view data, char delimiter,
+                          std::vector<size_t>& positions) {
+    positions.clear();
+
+    const char* ptr = data.data();
+    const size_t size = data.size();
+    size_t pos = 0;
+
+    // Process 32 bytes at a time using AVX2
+    constexpr size_t SIMD_WIDTH = 32;
+    const size_t simd_end = size - (size % SIMD_WIDTH);
+
+    const __m256i delim_vec = _mm256_set1_epi8(delimiter);
+
+    for (; pos < simd_end; pos += SIMD_WIDTH) {
+        __m256i data_vec = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(ptr + pos)
+        );
+
+        // movemask packs the top bit of each compared byte into a 32-bit mask
+        uint32_t match_mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(data_vec, delim_vec))
+        );
+
+        while (match_mask != 0) {
+            unsigned int bit_pos = __builtin_ctz(match_mask);
+            positions.push_back(pos + bit_pos);
+            match_mask &= (match_mask - 1);
+        }
+    }
+
+    for (; pos < size; ++pos) {
+        if (ptr[pos] == delimiter) {
+            positions.push_back(pos);
+        }
+    }
+}
+
+std::vector<size_t> find_delimiters_avx2(std::string_view data, char delimiter) {
     std::vector<size_t> positions;
     positions.reserve(data.size() / 10);
+    find_delimiters_avx2(data, delimiter, positions);
+    return positions;
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void find_delimiters_avx512(std::string_view data, char delimiter,
+                            std::vector<size_t>& positions) {
+    positions.clear();
 
     const char* ptr = data.data();
     const size_t size = data.size();
@@ -92,11 +1327,165 @@ std::vector<size_t> find_delimiters_simd(std::string_view data, char delimiter)
             positions.push_back(pos);
         }
     }
+}
+
+std::vector<size_t> find_delimiters_avx512(std::string_view data, char delimiter) {
+    std::vector<size_t> positions;
+    positions.reserve(data.size() / 10);
+    find_delimiters_avx512(data, delimiter, positions);
+    return positions;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi2")))
+void find_delimiters_avx512_vbmi2(std::string_view data, char delimiter,
+                                  std::vector<size_t>& positions) {
+    positions.clear();
+
+    const __m512i delim_vec = _mm512_set1_epi8(delimiter);
+    // resize() would zero-fill slots the compress store overwrites anyway;
+    // appending from a block buffer copies into the existing capacity instead
+    alignas(64) size_t block[64];
+
+    for (size_t pos = 0; pos < data.size(); pos += 64) {
+        const __mmask64 valid = first_lanes(data.size() - pos);
+        __m512i data_vec = _mm512_maskz_loadu_epi8(valid, data.data() + pos);
+        const uint64_t mask = _mm512_mask_cmpeq_epi8_mask(valid, data_vec, delim_vec);
+
+        if (mask != 0) {
+            store_block_positions(block, mask, pos);
+            positions.insert(positions.end(), block, block + __builtin_popcountll(mask));
+        }
+    }
+}
+
+std::vector<size_t> find_delimiters_avx512_vbmi2(std::string_view data, char delimiter) {
+    std::vector<size_t> positions;
+    positions.reserve(data.size() / 10);
+    find_delimiters_avx512_vbmi2(data, delimiter, positions);
+    return positions;
+}
+
+void find_delimiters_simd(std::string_view data, char delimiter,
+                          std::vector<size_t>& positions) {
+    // Resolve the widest supported tier once, then call through the pointer
+    static const DelimiterFinder finder = select_delimiter_finder();
+    finder(data, delimiter, positions);
+}
 
+std::vector<size_t> find_delimiters_simd(std::string_view data, char delimiter) {
+    std::vector<size_t> positions;
+    positions.reserve(data.size() / 10);
+    find_delimiters_simd(data, delimiter, positions);
     return positions;
 }
 
+size_t find_delimiters_scalar(std::string_view data, char delimiter, std::span<uint32_t> out) {
+    size_t count = 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i] == delimiter) {
+            if (count < out.size()) {
+                out[count] = static_cast<uint32_t>(i);
+            }
+            ++count;
+        }
+    }
+    return count;
+}
+
+size_t find_delimiters_scalar(std::string_view data, char delimiter, std::span<uint16_t> out) {
+    if (data.size() > MAX_UINT16_SCAN_SIZE) {
+        return DELIMITER_SCAN_TOO_LARGE;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i] == delimiter) {
+            if (count < out.size()) {
+                out[count] = static_cast<uint16_t>(i);
+            }
+            ++count;
+        }
+    }
+    return count;
+}
+
+void build_match_masks(std::string_view data, char needle, uint64_t* masks) {
+    static const MatchKernel match = select_match_kernel(cpu_features().best_level());
+    match(data.data(), data.size(), needle, masks);
+}
+
+size_t find_delimiters_simd(std::string_view data, char delimiter, std::span<uint32_t> out) {
+    static const SpanFinder<uint32_t> finder = select_span_finder<uint32_t>(cpu_features().best_level());
+    return finder(data, delimiter, out);
+}
+
+size_t find_delimiters_simd(std::string_view data, char delimiter, std::span<uint16_t> out) {
+    if (data.size() > MAX_UINT16_SCAN_SIZE) {
+        return DELIMITER_SCAN_TOO_LARGE;
+    }
+
+    static const SpanFinder<uint16_t> finder = select_span_finder<uint16_t>(cpu_features().best_level());
+    return finder(data, delimiter, out);
+}
+
+size_t find_delimiters_simd(std::string_view data, char delimiter, std::span<uint32_t> out,
+                            SimdLevel level) {
+    return select_span_finder<uint32_t>(level)(data, delimiter, out);
+}
+
+size_t find_delimiters_simd(std::string_view data, char delimiter, std::span<uint16_t> out,
+                            SimdLevel level) {
+    if (data.size() > MAX_UINT16_SCAN_SIZE) {
+        return DELIMITER_SCAN_TOO_LARGE;
+    }
+    return select_span_finder<uint16_t>(level)(data, delimiter, out);
+}
+
+void build_structural_index(std::string_view data, char delimiter, StructuralIndex& index,
+                            SimdLevel level) {
+    run_structural_classifier(select_structural_classifier<RuntimeDelimiter>(level),
+                              data, RuntimeDelimiter{delimiter}, index);
+}
+
+void build_structural_index(std::string_view data, char delimiter, StructuralIndex& index) {
+    static const StructuralClassifier<RuntimeDelimiter> classify =
+        select_structural_classifier<RuntimeDelimiter>(cpu_features().best_level());
+    run_structural_classifier(classify, data, RuntimeDelimiter{delimiter}, index);
+}
+
+template <char Delimiter>
+void build_structural_index(std::string_view data, StructuralIndex& index) {
+    static const StructuralClassifier<StaticDelimiter<Delimiter>> classify =
+        select_structural_classifier<StaticDelimiter<Delimiter>>(cpu_features().best_level());
+    run_structural_classifier(classify, data, StaticDelimiter<Delimiter>{}, index);
+}
+
+template void build_structural_index<'|'>(std::string_view, StructuralIndex&);
+template void build_structural_index<'\x01'>(std::string_view, StructuralIndex&);
+
+uint8_t compute_checksum_scalar(std::string_view data) {
+    return static_cast<uint8_t>(byte_sum_scalar(data.data(), data.size()));
+}
+
+uint8_t compute_checksum_simd(std::string_view data) {
+    static const ByteSumKernel byte_sum = select_byte_sum_kernel(cpu_features().best_level());
+    return static_cast<uint8_t>(byte_sum(data.data(), data.size()));
+}
+
 int32_t parse_int(std::string_view str) {
+    // Side and most enumerated fields are a single digit
+    if (str.size() == 1 && static_cast<unsigned char>(str[0] - '0') <= 9) {
+        return str[0] - '0';
+    }
+
+    // SWAR fast path: nine digits always fit, so no overflow check is needed
+    const size_t begin = !str.empty() && str[0] == '-' ? 1 : 0;
+    const size_t digits = str.size() - begin;
+    uint64_t value = 0;
+    if (digits - 1 < MAX_SWAR_INT_DIGITS && swar::accumulate_digits(str, begin, digits, value)) {
+        return begin != 0 ? -static_cast<int32_t>(value) : static_cast<int32_t>(value);
+    }
+
     int32_t result = 0;
 
     // Fast path for std::from_chars (C++17)
@@ -131,56 +1520,132 @@ int32_t parse_int(std::string_view str) {
     return negative ? -result : result;
 }
 
-double parse_double(std::string_view str) {
-    double result = 0.0;
+int64_t parse_int64(std::string_view str) {
+    static const DigitKernel digits16 = select_digit_kernel(cpu_features().best_level());
 
-    // Try std::from_chars first (C++17, but may not be available for double)
-    #ifdef __cpp_lib_to_chars
-    auto [ptr, ec] = std::from_chars(
-        str.data(),
-        str.data() + str.size(),
-        result
-    );
+    const size_t begin = !str.empty() && str[0] == '-' ? 1 : 0;
+    const size_t digits = str.size() - begin;
+    uint64_t value = 0;
+    if (digits - 1 < MAX_SIMD_INT_DIGITS && digits16(str.data() + begin, digits, value)) {
+        return begin != 0 ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+    }
 
+    // Longer or malformed input: from_chars, then the leading digits if any
+    int64_t result = 0;
+    auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
     if (ec == std::errc()) {
         return result;
     }
-    #endif
 
-    // Manual parsing for typical FIX prices (e.g., "150.25")
-    bool negative = false;
-    size_t i = 0;
+    result = 0;
+    for (size_t i = begin; i < str.size() && str[i] >= '0' && str[i] <= '9'; ++i) {
+        result = result * 10 + (str[i] - '0');
+    }
+    return begin != 0 ? -result : result;
+}
 
-    if (!str.empty() && str[0] == '-') {
-        negative = true;
-        i = 1;
+double parse_double(std::string_view str) {
+    // Longer mantissas would round twice; from_chars rounds them correctly
+    Decimal64 decimal;
+    if (parse_decimal(str, decimal) && decimal.converts_exactly()) {
+        return decimal.to_double();
     }
+    return parse_double_chars(str);
+}
 
-    // Parse integer part
-    double integer_part = 0.0;
-    for (; i < str.size() && str[i] != '.'; ++i) {
-        if (str[i] >= '0' && str[i] <= '9') {
-            integer_part = integer_part * 10.0 + (str[i] - '0');
-        }
+bool parse_decimal(std::string_view str, Decimal64& out) {
+    const size_t begin = !str.empty() && str[0] == '-' ? 1 : 0;
+
+    size_t dot = begin;
+    while (dot < str.size() && str[dot] != '.') {
+        ++dot;
     }
+    const size_t integer_digits = dot - begin;
+    const size_t fraction_digits = dot < str.size() ? str.size() - dot - 1 : 0;
 
-    // Parse fractional part
-    double fractional_part = 0.0;
-    if (i < str.size() && str[i] == '.') {
-        ++i;
-        double divisor = 10.0;
-        for (; i < str.size(); ++i) {
-            if (str[i] >= '0' && str[i] <= '9') {
-                fractional_part += (str[i] - '0') / divisor;
-                divisor *= 10.0;
-            } else {
-                break;
-            }
-        }
+    // Digits are required on both sides of a point; "5." and ".5" are rejected
+    if (integer_digits == 0 || (dot < str.size() && fraction_digits == 0) ||
+        integer_digits + fraction_digits > MAX_DECIMAL_DIGITS) {
+        return false;
     }
 
-    result = integer_part + fractional_part;
-    return negative ? -result : result;
+    uint64_t mantissa = 0;
+    if (!swar::accumulate_digits(str, begin, integer_digits, mantissa) ||
+        !swar::accumulate_digits(str, dot + 1, fraction_digits, mantissa)) {
+        return false;
+    }
+
+    out.mantissa = begin != 0 ? -static_cast<int64_t>(mantissa) : static_cast<int64_t>(mantissa);
+    out.exponent = -static_cast<int32_t>(fraction_digits);
+    return true;
+}
+
+Decimal64 parse_decimal(std::string_view str) {
+    Decimal64 result;
+    return parse_decimal(str, result) ? result : Decimal64{};
+}
+
+double parse_price_fallback(std::string_view str, Decimal64& decimal) {
+    if (!parse_decimal(str, decimal)) {
+        decimal = Decimal64{};
+    } else if (decimal.converts_exactly()) {
+        return 0.0;
+    }
+    return parse_double_chars(str);
+}
+
+double parse_price(std::string_view str, Decimal64& decimal) {
+    const double fallback = parse_price_fallback(str, decimal);
+    return fallback != 0.0 ? fallback : decimal.to_double();
+}
+
+void parse_int_batch(std::span<const std::string_view> values, std::span<int32_t> out) {
+    static const IntBatchKernel convert = select_int_batch_kernel(cpu_features().best_level());
+    convert(values.data(), values.size(), out.data());
+}
+
+void parse_price_batch(std::span<const std::string_view> values, std::span<double> prices,
+                       std::span<Decimal64> decimals) {
+    static const PriceBatchKernel convert = select_price_batch_kernel(cpu_features().best_level());
+    convert(values.data(), values.size(), prices.data(), decimals.data());
+}
+
+bool parse_timestamp_scalar(std::string_view str, int64_t& nanos) {
+    if (str.size() < MIN_TIMESTAMP_LENGTH || str.size() > MAX_TIMESTAMP_LENGTH || str[8] != '-' ||
+        str[11] != ':' || str[14] != ':') {
+        return false;
+    }
+
+    bool digits_ok = true;
+    auto number = [&](size_t pos, size_t length) {
+        uint32_t value = 0;
+        for (size_t i = pos; i < pos + length; ++i) {
+            const uint32_t digit = static_cast<uint8_t>(str[i] - '0');
+            digits_ok &= digit <= 9;
+            value = value * 10 + digit;
+        }
+        return value;
+    };
+    const uint32_t year = number(0, 4);
+    const uint32_t month = number(4, 2);
+    const uint32_t day = number(6, 2);
+    const uint32_t hour = number(9, 2);
+    const uint32_t minute = number(12, 2);
+    const uint32_t second = number(15, 2);
+
+    int64_t fraction_nanos;
+    return digits_ok && timestamp_fraction(str, fraction_nanos) &&
+           combine_timestamp(year, month, day, hour, minute, second, fraction_nanos, nanos);
+}
+
+bool parse_timestamp(std::string_view str, int64_t& nanos) {
+    static const TimestampParser parse = select_timestamp_parser(cpu_features().best_level());
+    return parse(str, nanos);
+}
+
+int64_t parse_timestamp(std::string_view str) {
+    int64_t nanos = 0;
+    return parse_timestamp(str, nanos) ? nanos : 0;
 }
 
 } // namespace simd_parser
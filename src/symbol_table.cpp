@@ -0,0 +1,250 @@
+#include "symbol_table.hpp"
+#include "simd_utils.hpp"
+#include "swar.hpp"
+#include <cstring>
+#include <immintrin.h>
+
+namespace simd_parser {
+
+namespace {
+
+using detail::SymbolGroup;
+
+constexpr uint64_t KEY_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+// Set in keys derived from a hash; never set in a packed key
+constexpr uint64_t HASHED_KEY = 1ULL << 63;
+
+constexpr size_t PACKED_KEY_BYTES = 8;
+
+template <typename Word>
+uint64_t load_bytes(const char* data) {
+    Word word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/**
+ * Key of a non-empty symbol. Up to eight bytes are packed into the key itself
+ * (first byte lowest), so equal keys mean equal symbols; anything longer is
+ * hashed and must be confirmed against the stored name. Packing requires a
+ * non-NUL last byte, which makes the length recoverable from the key, and an
+ * ASCII eighth byte, which keeps HASHED_KEY clear.
+ */
+uint64_t symbol_key(std::string_view symbol) {
+    const size_t size = symbol.size();
+    const uint8_t last = static_cast<uint8_t>(symbol[size - 1]);
+    if (size == PACKED_KEY_BYTES && last != 0 && last < 0x80) {
+        return swar::load_word(symbol.data());
+    }
+    if (size < PACKED_KEY_BYTES && last != 0) {
+        // Two overlapping loads cover the symbol; the shared bytes are equal,
+        // so OR-ing them is harmless. Avoids a length-dependent byte loop.
+        const char* data = symbol.data();
+        if (size >= 4) {
+            return load_bytes<uint32_t>(data) | (load_bytes<uint32_t>(data + size - 4) << (8 * (size - 4)));
+        }
+        if (size >= 2) {
+            return load_bytes<uint16_t>(data) | (load_bytes<uint16_t>(data + size - 2) << (8 * (size - 2)));
+        }
+        return last;
+    }
+
+    uint64_t hash = size * KEY_MULTIPLIER;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        hash = (hash ^ swar::load_word(symbol.data() + i)) * KEY_MULTIPLIER;
+        hash ^= hash >> 29;
+    }
+    uint64_t tail = 0;
+    for (; i < size; ++i) {
+        tail = (tail << 8) | static_cast<uint8_t>(symbol[i]);
+    }
+    hash = (hash ^ tail) * KEY_MULTIPLIER;
+    return (hash ^ (hash >> 32)) | HASHED_KEY;
+}
+
+size_t home_group(uint64_t key, size_t group_mask) {
+    return static_cast<size_t>((key * KEY_MULTIPLIER) >> 32) & group_mask;
+}
+
+// ----------------------------------------------------------------------------
+// Group probes
+//
+// Each tier compares a key against the eight keys of a group at once and
+// returns a bitmask of equal lanes. Probing the same group for 0 finds its
+// free lanes.
+// ----------------------------------------------------------------------------
+
+struct MatchKeysScalar {
+    static uint32_t match(const uint64_t* keys, uint64_t key) {
+        uint32_t mask = 0;
+        for (size_t lane = 0; lane < SymbolGroup::WIDTH; ++lane) {
+            mask |= static_cast<uint32_t>(keys[lane] == key) << lane;
+        }
+        return mask;
+    }
+};
+
+struct MatchKeysAVX2 {
+    __attribute__((target("avx2")))
+    static uint32_t match(const uint64_t* keys, uint64_t key) {
+        const __m256i needle = _mm256_set1_epi64x(static_cast<long long>(key));
+        const __m256i low = _mm256_load_si256(reinterpret_cast<const __m256i*>(keys));
+        const __m256i high = _mm256_load_si256(reinterpret_cast<const __m256i*>(keys + 4));
+        const uint32_t low_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(low, needle)));
+        const uint32_t high_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(high, needle)));
+        return low_mask | (high_mask << 4);
+    }
+};
+
+struct MatchKeysAVX512 {
+    __attribute__((target("avx512f")))
+    static uint32_t match(const uint64_t* keys, uint64_t key) {
+        return _mm512_cmpeq_epi64_mask(_mm512_load_si512(keys),
+                                       _mm512_set1_epi64(static_cast<long long>(key)));
+    }
+};
+
+/**
+ * Where a key lives, or the free entry it would go to.
+ */
+struct ProbeResult {
+    uint32_t id;    // NO_SYMBOL_ID if the symbol is not in the table
+    size_t group;
+    uint32_t lane;
+};
+
+// Out of line so the packed-key probe keeps its vectors in registers
+__attribute__((noinline)) bool has_name(const std::deque<std::string>& names, uint32_t id,
+                                        std::string_view symbol) {
+    return names[id] == symbol;
+}
+
+/**
+ * Walks groups from the key's home group until it finds the key or a group
+ * with a free entry. The table is never full, so the walk ends.
+ *
+ * Always inlined into the per-tier wrappers below, which carry the target
+ * attribute the matcher needs.
+ */
+template <typename MatchKeys>
+__attribute__((always_inline)) inline ProbeResult probe(const SymbolGroup* groups, size_t group_mask,
+                                                        uint64_t key, std::string_view symbol,
+                                                        const std::deque<std::string>& names) {
+    for (size_t g = home_group(key, group_mask);; g = (g + 1) & group_mask) {
+        const SymbolGroup& group = groups[g];
+        for (uint32_t hits = MatchKeys::match(group.keys, key); hits != 0; hits &= hits - 1) {
+            const uint32_t lane = static_cast<uint32_t>(__builtin_ctz(hits));
+            const uint32_t id = group.ids[lane];
+            if ((key & HASHED_KEY) == 0 || has_name(names, id, symbol)) {
+                return {id, g, lane};
+            }
+        }
+        const uint32_t free_lanes = MatchKeys::match(group.keys, 0);
+        if (free_lanes != 0) {
+            return {NO_SYMBOL_ID, g, static_cast<uint32_t>(__builtin_ctz(free_lanes))};
+        }
+    }
+}
+
+using SymbolProbe = ProbeResult (*)(const SymbolGroup*, size_t, uint64_t, std::string_view,
+                                    const std::deque<std::string>&);
+
+ProbeResult probe_scalar(const SymbolGroup* groups, size_t group_mask, uint64_t key,
+                         std::string_view symbol, const std::deque<std::string>& names) {
+    return probe<MatchKeysScalar>(groups, group_mask, key, symbol, names);
+}
+
+__attribute__((target("avx2")))
+ProbeResult probe_avx2(const SymbolGroup* groups, size_t group_mask, uint64_t key,
+                       std::string_view symbol, const std::deque<std::string>& names) {
+    return probe<MatchKeysAVX2>(groups, group_mask, key, symbol, names);
+}
+
+__attribute__((target("avx512f")))
+ProbeResult probe_avx512(const SymbolGroup* groups, size_t group_mask, uint64_t key,
+                         std::string_view symbol, const std::deque<std::string>& names) {
+    return probe<MatchKeysAVX512>(groups, group_mask, key, symbol, names);
+}
+
+SymbolProbe select_symbol_probe(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512VBMI2:
+        case SimdLevel::AVX512:
+            return probe_avx512;
+        case SimdLevel::AVX2:
+            return probe_avx2;
+        case SimdLevel::SSE42:
+        case SimdLevel::Scalar:
+            break;
+    }
+    return probe_scalar;
+}
+
+ProbeResult probe_symbol(const std::vector<SymbolGroup>& groups, uint64_t key, std::string_view symbol,
+                         const std::deque<std::string>& names) {
+    static const SymbolProbe probe = select_symbol_probe(cpu_features().best_level());
+    return probe(groups.data(), groups.size() - 1, key, symbol, names);
+}
+
+} // anonymous namespace
+
+SymbolTable::SymbolTable(size_t expected_symbols) {
+    // Smallest power-of-two group count that keeps the load at 7/8
+    const size_t entries = expected_symbols + expected_symbols / 7 + 1;
+    size_t group_count = 1;
+    while (group_count * SymbolGroup::WIDTH < entries) {
+        group_count *= 2;
+    }
+    groups_.resize(group_count);
+}
+
+uint32_t SymbolTable::intern(std::string_view symbol) {
+    if (symbol.empty()) {
+        return NO_SYMBOL_ID;
+    }
+
+    const uint64_t key = symbol_key(symbol);
+    ProbeResult slot = probe_symbol(groups_, key, symbol, names_);
+    if (slot.id != NO_SYMBOL_ID) {
+        return slot.id;
+    }
+
+    if ((names_.size() + 1) * 8 > capacity() * 7) {
+        rehash(groups_.size() * 2);
+        slot = probe_symbol(groups_, key, symbol, names_);
+    }
+
+    const uint32_t id = static_cast<uint32_t>(names_.size());
+    names_.emplace_back(symbol);
+    groups_[slot.group].keys[slot.lane] = key;
+    groups_[slot.group].ids[slot.lane] = id;
+    return id;
+}
+
+uint32_t SymbolTable::find(std::string_view symbol) const {
+    if (symbol.empty()) {
+        return NO_SYMBOL_ID;
+    }
+    return probe_symbol(groups_, symbol_key(symbol), symbol, names_).id;
+}
+
+void SymbolTable::rehash(size_t group_count) {
+    std::vector<SymbolGroup> old_groups(group_count);
+    old_groups.swap(groups_);
+
+    for (const SymbolGroup& group : old_groups) {
+        for (size_t lane = 0; lane < SymbolGroup::WIDTH; ++lane) {
+            if (group.keys[lane] == 0) {
+                continue;
+            }
+            const uint32_t id = group.ids[lane];
+            const ProbeResult slot = probe_symbol(groups_, group.keys[lane], names_[id], names_);
+            groups_[slot.group].keys[slot.lane] = group.keys[lane];
+            groups_[slot.group].ids[slot.lane] = id;
+        }
+    }
+}
+
+} // namespace simd_parser
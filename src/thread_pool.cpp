@@ -0,0 +1,132 @@
+#include "thread_pool.hpp"
+
+namespace simd_parser {
+
+namespace {
+
+constexpr uint64_t pack_range(uint64_t begin, uint64_t end) {
+    return begin | (end << 32);
+}
+
+constexpr uint64_t range_begin(uint64_t bounds) {
+    return bounds & 0xFFFFFFFFULL;
+}
+
+constexpr uint64_t range_end(uint64_t bounds) {
+    return bounds >> 32;
+}
+
+} // anonymous namespace
+
+ThreadPool::ThreadPool(size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+
+    ranges_ = std::make_unique<TaskRange[]>(threads);
+    counters_.resize(threads);
+    threads_.reserve(threads);
+    for (size_t worker = 0; worker < threads; ++worker) {
+        threads_.emplace_back([this, worker] { worker_loop(worker); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    stopping_.store(true, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+void ThreadPool::run(size_t task_count, const Task& task) {
+    const size_t workers = size();
+    for (size_t worker = 0; worker < workers; ++worker) {
+        ranges_[worker].bounds.store(pack_range(task_count * worker / workers,
+                                                task_count * (worker + 1) / workers),
+                                     std::memory_order_relaxed);
+        counters_[worker] = WorkerCounters();
+    }
+    if (task_count == 0) {
+        return;
+    }
+
+    task_ = &task;
+    running_.store(workers, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+
+    for (size_t running; (running = running_.load(std::memory_order_acquire)) != 0;) {
+        running_.wait(running, std::memory_order_acquire);
+    }
+    task_ = nullptr;
+}
+
+void ThreadPool::worker_loop(size_t worker) {
+    uint64_t seen = 0;
+    for (;;) {
+        generation_.wait(seen, std::memory_order_acquire);
+        seen = generation_.load(std::memory_order_acquire);
+        if (stopping_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const Task* task = task_;
+
+        size_t index;
+        while (take_own(worker, index) || steal(worker, index)) {
+            (*task)(index, worker);
+            ++counters_[worker].tasks;
+        }
+
+        if (running_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            running_.notify_one();
+        }
+    }
+}
+
+bool ThreadPool::take_own(size_t worker, size_t& task) {
+    std::atomic<uint64_t>& bounds = ranges_[worker].bounds;
+    uint64_t current = bounds.load(std::memory_order_relaxed);
+    for (;;) {
+        const uint64_t begin = range_begin(current);
+        const uint64_t end = range_end(current);
+        if (begin >= end) {
+            return false;
+        }
+        if (bounds.compare_exchange_weak(current, pack_range(begin + 1, end), std::memory_order_relaxed)) {
+            task = begin;
+            return true;
+        }
+    }
+}
+
+bool ThreadPool::steal(size_t thief, size_t& task) {
+    const size_t workers = size();
+    for (size_t offset = 1; offset < workers; ++offset) {
+        std::atomic<uint64_t>& bounds = ranges_[(thief + offset) % workers].bounds;
+        uint64_t current = bounds.load(std::memory_order_relaxed);
+        for (;;) {
+            const uint64_t begin = range_begin(current);
+            const uint64_t end = range_end(current);
+            if (begin >= end) {
+                break;
+            }
+            // Take the back half (the whole range if it holds one task)
+            const uint64_t split = begin + (end - begin) / 2;
+            if (bounds.compare_exchange_weak(current, pack_range(begin, split), std::memory_order_relaxed)) {
+                // Our range is empty, so no other thief is touching it
+                ranges_[thief].bounds.store(pack_range(split + 1, end), std::memory_order_relaxed);
+                ++counters_[thief].steals;
+                task = split;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace simd_parser
@@ -0,0 +1,218 @@
+/**
+ * Generated Parser Unit Tests
+ *
+ * Tests for the message structs fix_codegen generates from spec/FIX44.xml
+ * (and tests/spec/WIDE.xml) and for parse_message() driving them.
+ */
+
+#include <gtest/gtest.h>
+#include "fix44_messages.hpp"
+#include "test_data.hpp"
+#include "wide_messages.hpp"
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Test Fixtures
+// ============================================================================
+
+// Set bits across a multi-word required/present set
+template <size_t N>
+size_t count_bits(const std::array<uint64_t, N>& words) {
+    size_t bits = 0;
+    for (uint64_t word : words) {
+        bits += static_cast<size_t>(__builtin_popcountll(word));
+    }
+    return bits;
+}
+
+// WideMessage with every field 5000..5299, or without those in `skip`
+std::string make_wide_message(std::initializer_list<uint32_t> skip = {}) {
+    std::string body = "35=UW|49=TRADER|56=EXCHANGE|";
+    for (uint32_t tag = 5000; tag < 5300; ++tag) {
+        if (std::find(skip.begin(), skip.end(), tag) == skip.end()) {
+            body += std::to_string(tag);
+            body += '=';
+            body += std::to_string(tag % 10);
+            body += '|';
+        }
+    }
+    return test_data::with_header(body);
+}
+
+class CodegenTest : public ::testing::Test {
+protected:
+    ParserContext context;
+};
+
+inline const std::string NEW_ORDER = test_data::with_header(
+    "35=D|49=TRADER|56=EXCHANGE|34=7|52=20240115-14:30:00.000|"
+    "11=ORD-1|1=ACC-9|55=AAPL|54=1|60=20240115-14:30:00.000|38=100|40=2|44=150.25|");
+
+inline const std::string EXECUTION_REPORT = test_data::with_header(
+    "35=8|49=EXCHANGE|56=TRADER|34=12|52=20240115-14:30:00.123|43=Y|"
+    "37=EX-1|11=ORD-1|17=E-1|150=F|39=2|55=AAPL|54=1|38=100|"
+    "32=100|31=150.20|151=0|14=100|6=150.20|58=filled|");
+
+// ============================================================================
+// Generated Structure Tests
+// ============================================================================
+
+TEST(GeneratedStructTest, TypedMembers) {
+    static_assert(std::is_same_v<decltype(fix44::NewOrderSingle::cl_ord_id), std::string_view>);
+    static_assert(std::is_same_v<decltype(fix44::NewOrderSingle::price), double>);
+    static_assert(std::is_same_v<decltype(fix44::NewOrderSingle::side), char>);
+    static_assert(std::is_same_v<decltype(fix44::NewOrderSingle::msg_seq_num), int32_t>);
+    static_assert(std::is_same_v<decltype(fix44::ExecutionReport::poss_dup_flag), bool>);
+    SUCCEED();
+}
+
+TEST(GeneratedStructTest, MessageTypesAndSlots) {
+    static_assert(fix44::NewOrderSingle::MSG_TYPE == "D");
+    static_assert(fix44::ExecutionReport::MSG_TYPE == "8");
+    static_assert(fix44::OrderCancelRequest::MSG_TYPE == "F");
+
+    // Framing tags are handled by parse_message, not stored
+    static_assert(fix44::NewOrderSingle::SLOTS[35] == 0);
+    static_assert(fix44::NewOrderSingle::SLOTS[9] == 0);
+    static_assert(fix44::NewOrderSingle::SLOTS[11] != 0);
+
+    // Fields of other messages have no slot
+    EXPECT_EQ(fix44::NewOrderSingle::SLOTS[37], 0);
+}
+
+TEST(GeneratedStructTest, RequiredMask) {
+    // Header: SenderCompID, TargetCompID, MsgSeqNum, SendingTime.
+    // NewOrderSingle: ClOrdID, Side, TransactTime, OrdType. Symbol and
+    // OrderQty sit in required components but are optional themselves.
+    EXPECT_EQ(count_bits(fix44::NewOrderSingle::REQUIRED_MASK), 8u);
+    static_assert(fix44::NewOrderSingle::MASK_WORDS == 1);
+}
+
+TEST(GeneratedStructTest, WideMessageSpansSeveralWords) {
+    // SenderCompID, TargetCompID and 300 body fields
+    static_assert(wide::WideMessage::FIELD_COUNT == 302);
+    static_assert(wide::WideMessage::MASK_WORDS == 5);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(wide::WideMessage::SLOTS)>::value_type, uint16_t>);
+    static_assert(wide::WideMessage::SLOTS[5299] == 302);
+
+    // Header pair, 5000, 5063, 5064, 5151 (in a required component), 5200, 5299
+    EXPECT_EQ(count_bits(wide::WideMessage::REQUIRED_MASK), 8u);
+}
+
+// ============================================================================
+// Parsing Tests
+// ============================================================================
+
+TEST_F(CodegenTest, ParsesNewOrderSingle) {
+    fix44::NewOrderSingle order;
+    ASSERT_TRUE(parse_message(NEW_ORDER, context, order));
+
+    EXPECT_EQ(order.sender_comp_id, "TRADER");
+    EXPECT_EQ(order.target_comp_id, "EXCHANGE");
+    EXPECT_EQ(order.msg_seq_num, 7);
+    EXPECT_EQ(order.cl_ord_id, "ORD-1");
+    EXPECT_EQ(order.account, "ACC-9");
+    EXPECT_EQ(order.symbol, "AAPL");
+    EXPECT_EQ(order.side, '1');
+    EXPECT_EQ(order.ord_type, '2');
+    EXPECT_DOUBLE_EQ(order.order_qty, 100.0);
+    EXPECT_DOUBLE_EQ(order.price, 150.25);
+    EXPECT_EQ(order.transact_time, "20240115-14:30:00.000");
+}
+
+TEST_F(CodegenTest, ParsesExecutionReport) {
+    fix44::ExecutionReport report;
+    ASSERT_TRUE(parse_message(EXECUTION_REPORT, context, report));
+
+    EXPECT_EQ(report.order_id, "EX-1");
+    EXPECT_EQ(report.exec_type, 'F');
+    EXPECT_EQ(report.ord_status, '2');
+    EXPECT_TRUE(report.poss_dup_flag);
+    EXPECT_DOUBLE_EQ(report.last_px, 150.20);
+    EXPECT_DOUBLE_EQ(report.leaves_qty, 0.0);
+    EXPECT_DOUBLE_EQ(report.cum_qty, 100.0);
+    EXPECT_EQ(report.text, "filled");
+}
+
+TEST_F(CodegenTest, PresentBitsTrackFields) {
+    fix44::NewOrderSingle order;
+    ASSERT_TRUE(parse_message(NEW_ORDER, context, order));
+
+    // PossDupFlag (43), SecurityID (48) and TimeInForce (59) were not sent
+    EXPECT_EQ(count_bits(order.present), order.FIELD_COUNT - 3);
+}
+
+TEST_F(CodegenTest, ParsesWideMessage) {
+    // The struct's views point into the input, so keep it alive
+    const std::string wide = make_wide_message();
+    wide::WideMessage message;
+    ASSERT_TRUE(parse_message(wide, context, message));
+
+    EXPECT_EQ(count_bits(message.present), message.FIELD_COUNT);
+    EXPECT_EQ(message.sender_comp_id, "TRADER");
+    EXPECT_EQ(message.field5000, 0);            // INT
+    EXPECT_DOUBLE_EQ(message.field5149, 9.0);   // PRICE
+    EXPECT_EQ(message.field5298, "8");          // STRING
+    EXPECT_EQ(message.field5299, '9');          // CHAR, the last slot
+}
+
+TEST_F(CodegenTest, WideMessageChecksEveryRequiredWord) {
+    // One required field per mask word beyond the first
+    for (uint32_t tag : {5000u, 5063u, 5151u, 5200u, 5299u}) {
+        SCOPED_TRACE(tag);
+        wide::WideMessage message;
+        EXPECT_FALSE(parse_message(make_wide_message({tag}), context, message));
+    }
+    // Optional fields may be missing
+    wide::WideMessage message;
+    EXPECT_TRUE(parse_message(make_wide_message({5001, 5100, 5298}), context, message));
+}
+
+TEST_F(CodegenTest, WrongMessageTypeRejected) {
+    fix44::ExecutionReport report;
+    EXPECT_FALSE(parse_message(NEW_ORDER, context, report));
+}
+
+TEST_F(CodegenTest, MissingRequiredFieldRejected) {
+    // No ClOrdID (11)
+    std::string msg = test_data::with_header(
+        "35=D|49=TRADER|56=EXCHANGE|34=7|52=20240115-14:30:00.000|"
+        "55=AAPL|54=1|60=20240115-14:30:00.000|40=1|");
+    fix44::NewOrderSingle order;
+
+    EXPECT_FALSE(parse_message(msg, context, order));
+    EXPECT_EQ(order.symbol, "AAPL");
+}
+
+TEST_F(CodegenTest, TruncatedMessageRejected) {
+    fix44::NewOrderSingle order;
+    EXPECT_FALSE(parse_message(NEW_ORDER.substr(0, NEW_ORDER.size() - 15), context, order));
+}
+
+TEST_F(CodegenTest, ReuseResetsMessage) {
+    fix44::NewOrderSingle order;
+    ASSERT_TRUE(parse_message(NEW_ORDER, context, order));
+
+    std::string market = test_data::with_header(
+        "35=D|49=TRADER|56=EXCHANGE|34=8|52=20240115-14:30:01.000|"
+        "11=ORD-2|55=MSFT|54=2|60=20240115-14:30:01.000|40=1|");
+    ASSERT_TRUE(parse_message(market, context, order));
+
+    EXPECT_EQ(order.cl_ord_id, "ORD-2");
+    EXPECT_DOUBLE_EQ(order.price, 0.0);
+    EXPECT_TRUE(order.account.empty());
+}
+
+TEST_F(CodegenTest, SOH) {
+    std::string wire = test_data::to_soh(NEW_ORDER);
+    fix44::NewOrderSingle order;
+
+    ASSERT_TRUE((parse_message<fix44::NewOrderSingle, SOH>(wire, context, order)));
+    EXPECT_EQ(order.cl_ord_id, "ORD-1");
+}
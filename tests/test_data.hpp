@@ -6,7 +6,12 @@
  * Shared test data for all unit tests.
  */
 
+#include "framer.hpp"
+#include "simd_utils.hpp"
+#include <array>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace test_data {
@@ -32,7 +37,7 @@ inline const std::string MINIMAL =
 
 // Message with all supported fields
 inline const std::string FULL_MESSAGE =
-    "8=FIX.4.4|9=128|35=D|49=HEDGE_FUND|56=DARK_POOL|55=NVDA|54=2|38=1000|44=875.30|";
+    "8=FIX.4.4|9=63|35=D|49=HEDGE_FUND|56=DARK_POOL|55=NVDA|54=2|38=1000|44=875.30|";
 
 // Buy order
 inline const std::string BUY_ORDER =
@@ -134,6 +139,20 @@ inline const std::vector<std::pair<std::string, int32_t>> INT_CASES = {
     {"-2147483648", -2147483648}, // INT32_MIN
 };
 
+// 64-bit integer test cases: {input, expected_output}
+inline const std::vector<std::pair<std::string, int64_t>> INT64_CASES = {
+    {"0", 0},
+    {"7", 7},
+    {"12345678", 12345678},
+    {"123456789", 123456789},
+    {"1234567890123456", 1234567890123456},
+    {"9999999999999999", 9999999999999999},
+    {"-9999999999999999", -9999999999999999},
+    {"0000000000000042", 42},
+    {"12345678901234567", 12345678901234567},     // Past the vector width
+    {"9223372036854775807", INT64_MAX},
+};
+
 // Double test cases: {input, expected_output}
 inline const std::vector<std::pair<std::string, double>> DOUBLE_CASES = {
     {"0", 0.0},
@@ -151,6 +170,29 @@ inline const std::vector<std::pair<std::string, double>> DOUBLE_CASES = {
     {"0.0025", 0.0025},
 };
 
+// Exact decimal parse results: input, mantissa, exponent
+struct DecimalCase {
+    std::string input;
+    int64_t mantissa;
+    int32_t exponent;
+};
+
+inline const std::vector<DecimalCase> DECIMAL_CASES = {
+    {"0", 0, 0},
+    {"0.0", 0, -1},
+    {"1.5", 15, -1},
+    {"150.25", 15025, -2},
+    {"150.250", 150250, -3},
+    {"0.0001", 1, -4},
+    {"-123.456", -123456, -3},
+    {"628450.00", 62845000, -2},
+    {"12345678", 12345678, 0},
+    {"123456789", 123456789, 0},
+    {"1234567.12345678", 123456712345678, -8},
+    {"999999999999999999", 999999999999999999, 0},
+    {"-0.00000000000000001", -1, -17},
+};
+
 // Edge cases for numeric parsing
 inline const std::vector<std::string> INVALID_NUMBERS = {
     "",
@@ -197,7 +239,7 @@ inline const std::vector<DelimiterTestCase> CASES = {
     // Different delimiter
     {"a,b,c", ',', {1, 3}},
     {"a=b=c", '=', {1, 3}},
-    {"a\x01b\x01c", '\x01', {1, 3}},  // SOH delimiter (real FIX)
+    {"a\x01" "b\x01" "c", '\x01', {1, 3}},  // SOH delimiter (real FIX)
 };
 
 // Generate string of specific length with evenly distributed delimiters
@@ -226,6 +268,89 @@ inline std::string generate_test_string(size_t length, size_t delimiter_count, c
 
 }  // namespace delimiters
 
+// Converts a '|'-delimited test message to wire-format SOH delimiters
+inline std::string to_soh(std::string msg) {
+    for (char& c : msg) {
+        if (c == '|') {
+            c = '\x01';
+        }
+    }
+    return msg;
+}
+
+// Appends a CheckSum trailer ("10=NNN" + delimiter) matching the message bytes
+inline std::string with_checksum(std::string msg, char delimiter = '|') {
+    unsigned sum = 0;
+    for (char c : msg) {
+        sum += static_cast<unsigned char>(c);
+    }
+    std::string digits = std::to_string(sum % 256);
+    msg += "10=" + std::string(3 - digits.size(), '0') + digits + delimiter;
+    return msg;
+}
+
+// Wraps a message body in a standard header ("8=FIX.4.4", "9=<body size>")
+// and a matching CheckSum trailer
+inline std::string with_header(const std::string& body, char delimiter = '|') {
+    std::string msg = "8=FIX.4.4";
+    msg += delimiter;
+    msg += "9=" + std::to_string(body.size());
+    msg += delimiter;
+    return with_checksum(msg + body, delimiter);
+}
+
+// Back-to-back messages with headers and CheckSum trailers, cycling through
+// five bodies: three orders/reports, one without price fields and one
+// without a symbol (invalid)
+inline std::string generate_message_stream(size_t count, char delimiter = '|') {
+    const char* bodies[] = {
+        "35=D|49=A|56=B|55=AAPL|54=1|38=100|44=150.25|",
+        "35=8|49=B|56=A|55=MSFT|54=2|38=2500|44=378.5|",
+        "35=AE|49=C|56=D|55=ESZ4 Comdty|54=1|38=7|44=0.0025|",
+        "35=F|49=A|56=B|55=GOOGL|52=20241115-14:30:00.123|",
+        "35=D|49=A|56=B|54=1|38=1|44=1|",
+    };
+    std::string stream;
+    for (size_t i = 0; i < count; ++i) {
+        std::string body = bodies[i % 5];
+        if (delimiter != '|') {
+            body = to_soh(body);
+        }
+        stream += with_header(body, delimiter);
+    }
+    return stream;
+}
+
+// Frames a whole stream single-threaded, as a reference for the batch and
+// multi-threaded paths
+template <char Delimiter = '|'>
+std::vector<std::string_view> frame_stream(std::string_view stream) {
+    std::vector<std::string_view> messages;
+    std::array<std::string_view, 64> views;
+    while (!stream.empty()) {
+        simd_parser::FrameResult result = simd_parser::frame_messages<Delimiter>(stream, views, true);
+        messages.insert(messages.end(), views.begin(), views.begin() + result.message_count);
+        if (result.consumed == 0) {
+            break;
+        }
+        stream.remove_prefix(result.consumed);
+    }
+    return messages;
+}
+
+// Every SIMD level the current CPU can execute, including scalar
+inline std::vector<simd_parser::SimdLevel> supported_levels() {
+    using simd_parser::SimdLevel;
+    std::vector<SimdLevel> levels;
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE42, SimdLevel::AVX2, SimdLevel::AVX512,
+                            SimdLevel::AVX512VBMI2}) {
+        if (level <= simd_parser::cpu_features().best_level()) {
+            levels.push_back(level);
+        }
+    }
+    return levels;
+}
+
 // Batch of messages for throughput testing
 inline std::vector<std::string> generate_message_batch(size_t count) {
     std::vector<std::string> messages;
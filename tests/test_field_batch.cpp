@@ -0,0 +1,207 @@
+/**
+ * Field Batch Unit Tests
+ *
+ * Tests for extract_field_batch() and extract_price_batch(): every tier must
+ * find the same value as a plain field walk, wherever the field sits
+ * relative to the 32- and 64-byte blocks.
+ */
+
+#include <gtest/gtest.h>
+#include "field_batch.hpp"
+#include "parser.hpp"
+#include "test_data.hpp"
+#include <string>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+// First value of `tag`, found by walking the fields one by one
+std::string_view reference_field(std::string_view message, uint32_t tag, char delimiter = '|') {
+    const std::string prefix = std::to_string(tag) + "=";
+    size_t pos = 0;
+    while (pos <= message.size()) {
+        size_t end = message.find(delimiter, pos);
+        if (end == std::string_view::npos) {
+            end = message.size();
+        }
+        const std::string_view field = message.substr(pos, end - pos);
+        if (field.starts_with(prefix)) {
+            return field.substr(prefix.size());
+        }
+        pos = end + 1;
+    }
+    return {};
+}
+
+std::vector<std::string_view> extract(const std::vector<std::string_view>& messages, uint32_t tag,
+                                      SimdLevel level) {
+    std::vector<std::string_view> values(messages.size());
+    extract_field_batch(messages, tag, values, level);
+    return values;
+}
+
+// ============================================================================
+// extract_field_batch Tests
+// ============================================================================
+
+TEST(FieldBatchTest, ShortMessages) {
+    const std::vector<std::string_view> messages = {
+        test_data::valid::MINIMAL,
+        test_data::valid::NEW_ORDER_SINGLE,
+        "8=FIX.4.4|35=D|55=SPY|54=1|38=100|44=450.00|",
+        "8=FIX.4.4|35=D|55=QQQ|54=2|38=5|44=1.5",  // No trailing delimiter
+        "8=FIX.4.4|35=D|55=IWM|54=1|38=7|",        // No price
+        "44=12.25|55=DIA|",                        // Price opens the message
+        "8=FIX.4.4|144=1|544=2|44=3|",             // Tags ending in 44 are not Price
+        "8=FIX.4.4|35=D|44=|55=X|",                // Empty price
+        "",
+    };
+    for (SimdLevel level : test_data::supported_levels()) {
+        SCOPED_TRACE(simd_level_name(level));
+        const auto values = extract(messages, 44, level);
+        for (size_t i = 0; i < messages.size(); ++i) {
+            SCOPED_TRACE(messages[i]);
+            EXPECT_EQ(values[i], reference_field(messages[i], 44));
+        }
+        EXPECT_EQ(values[2], "450.00");
+        EXPECT_EQ(values[3], "1.5");
+        EXPECT_EQ(values[4], "");
+        EXPECT_EQ(values[5], "12.25");
+        EXPECT_EQ(values[6], "3");
+        EXPECT_EQ(values[7], "");
+    }
+}
+
+TEST(FieldBatchTest, ValuesPointIntoMessages) {
+    const std::string message = "8=FIX.4.4|35=D|55=SPY|44=450.00|";
+    const std::vector<std::string_view> messages = {message};
+    for (SimdLevel level : test_data::supported_levels()) {
+        SCOPED_TRACE(simd_level_name(level));
+        const auto values = extract(messages, 55, level);
+        EXPECT_EQ(values[0].data(), message.data() + message.find("SPY"));
+        EXPECT_EQ(values[0].size(), 3u);
+    }
+}
+
+TEST(FieldBatchTest, FieldAtEveryOffset) {
+    // Slides the field across the 32- and 64-byte block boundaries, with
+    // values that end inside, at and beyond the block holding the tag
+    std::vector<std::string> storage;
+    for (size_t padding = 0; padding < 140; ++padding) {
+        for (size_t value_size : {0, 1, 7, 40, 70}) {
+            std::string message = "8=FIX.4.4|58=";
+            message.append(padding, 'x');
+            message += "|38=";
+            message.append(value_size, '7');
+            if (value_size % 2 == 0) {
+                message += "|10=000|";
+            }
+            storage.push_back(std::move(message));
+        }
+    }
+    const std::vector<std::string_view> messages(storage.begin(), storage.end());
+    for (SimdLevel level : test_data::supported_levels()) {
+        SCOPED_TRACE(simd_level_name(level));
+        const auto values = extract(messages, 38, level);
+        for (size_t i = 0; i < messages.size(); ++i) {
+            ASSERT_EQ(values[i], reference_field(messages[i], 38)) << messages[i];
+        }
+    }
+}
+
+TEST(FieldBatchTest, TagLengths) {
+    const std::vector<std::string_view> messages = {
+        "8=FIX.4.4|1=A|35=D|269=0|1000000=B|4294967295=C|",
+        test_data::valid::FULL_MESSAGE,
+        test_data::valid::LONG_IDS,
+    };
+    for (SimdLevel level : test_data::supported_levels()) {
+        SCOPED_TRACE(simd_level_name(level));
+        for (uint32_t tag : {1u, 8u, 35u, 269u, 1000000u, 4294967295u, 0u}) {
+            SCOPED_TRACE(tag);
+            const auto values = extract(messages, tag, level);
+            for (size_t i = 0; i < messages.size(); ++i) {
+                EXPECT_EQ(values[i], reference_field(messages[i], tag));
+            }
+        }
+    }
+}
+
+TEST(FieldBatchTest, SohDelimiter) {
+    const std::string message = test_data::to_soh("8=FIX.4.4|35=D|55=ESZ4|44=5000.25|");
+    const std::vector<std::string_view> messages = {message, message};
+    std::vector<std::string_view> values(messages.size());
+    for (SimdLevel level : test_data::supported_levels()) {
+        SCOPED_TRACE(simd_level_name(level));
+        extract_field_batch<SOH>(messages, 44, values, level);
+        EXPECT_EQ(values[0], "5000.25");
+        EXPECT_EQ(values[1], "5000.25");
+        // '|' is just a byte in an SOH message
+        extract_field_batch<'|'>(messages, 44, values, level);
+        EXPECT_EQ(values[0], "");
+    }
+}
+
+TEST(FieldBatchTest, BestLevelMatchesScalar) {
+    const std::vector<std::string_view> messages = {
+        test_data::valid::NEW_ORDER_SINGLE,
+        test_data::valid::EXECUTION_REPORT,
+        test_data::valid::LONG_SYMBOL,
+        test_data::invalid::NO_SYMBOL,
+    };
+    for (uint32_t tag : {35u, 44u, 55u, 10u}) {
+        std::vector<std::string_view> values(messages.size());
+        extract_field_batch(messages, tag, values);
+        EXPECT_EQ(values, extract(messages, tag, SimdLevel::Scalar)) << tag;
+    }
+}
+
+// ============================================================================
+// extract_price_batch Tests
+// ============================================================================
+
+TEST(FieldBatchTest, PriceBatchMatchesParser) {
+    // More messages than one conversion chunk
+    std::vector<std::string> storage;
+    for (int i = 0; i < 150; ++i) {
+        std::string message = "8=FIX.4.4|35=D|55=SPY|54=1|38=100|";
+        if (i % 7 != 3) {
+            message += "44=";
+            message += std::to_string(400 + i);
+            message += '.';
+            message += std::to_string(i % 100);
+            message += '|';
+        }
+        storage.push_back(std::move(message));
+    }
+    const std::vector<std::string_view> messages(storage.begin(), storage.end());
+    std::vector<double> prices(messages.size(), -1.0);
+    std::vector<Decimal64> decimals(messages.size());
+    extract_price_batch(messages, prices, decimals);
+
+    for (size_t i = 0; i < messages.size(); ++i) {
+        SCOPED_TRACE(messages[i]);
+        const FIXMessage parsed = parse_scalar(messages[i]);
+        EXPECT_DOUBLE_EQ(prices[i], parsed.price());
+        EXPECT_EQ(decimals[i].mantissa, parsed.price_decimal.mantissa);
+        EXPECT_EQ(decimals[i].exponent, parsed.price_decimal.exponent);
+    }
+    EXPECT_DOUBLE_EQ(prices[0], 400.0);
+    EXPECT_DOUBLE_EQ(prices[3], 0.0);
+    EXPECT_DOUBLE_EQ(prices[149], 549.49);
+}
+
+TEST(FieldBatchTest, PriceBatchSoh) {
+    const std::string message = test_data::to_soh("8=FIX.4.4|35=D|55=ESZ4|44=5000.25|");
+    const std::vector<std::string_view> messages = {message};
+    std::vector<double> prices(1);
+    std::vector<Decimal64> decimals(1);
+    extract_price_batch<SOH>(messages, prices, decimals);
+    EXPECT_DOUBLE_EQ(prices[0], 5000.25);
+    EXPECT_EQ(decimals[0].mantissa, 500025);
+    EXPECT_EQ(decimals[0].exponent, -2);
+}
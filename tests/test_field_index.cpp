@@ -0,0 +1,229 @@
+/**
+ * Field Index Unit Tests
+ *
+ * Tests for looking up arbitrary tags of a parsed message through the
+ * FieldIndex built by parse_simd().
+ */
+
+#include <gtest/gtest.h>
+#include "field_index.hpp"
+#include "parser.hpp"
+#include "test_data.hpp"
+#include <string>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Test Fixtures
+// ============================================================================
+
+class FieldIndexTest : public ::testing::Test {
+protected:
+    ParserContext context;
+    FieldIndex fields;
+};
+
+// Execution report carrying tags FIXMessage does not store
+inline const std::string EXECUTION_REPORT = test_data::with_header(
+    "35=8|49=EXCHANGE|56=TRADER|11=ORD-1001|37=EX-77|150=F|39=2|"
+    "55=MSFT|54=2|38=500|44=378.50|60=20240115-14:30:00.123|");
+
+// ============================================================================
+// Tag Parsing Tests
+// ============================================================================
+
+TEST(ParseTagTest, Digits) {
+    static_assert(parse_tag("35") == 35);
+
+    EXPECT_EQ(parse_tag("8"), 8u);
+    EXPECT_EQ(parse_tag("150"), 150u);
+    EXPECT_EQ(parse_tag("20001"), 20001u);
+    EXPECT_EQ(parse_tag("999999999"), 999999999u);
+}
+
+TEST(ParseTagTest, InvalidTagsAreZero) {
+    EXPECT_EQ(parse_tag(""), 0u);
+    EXPECT_EQ(parse_tag("3a"), 0u);
+    EXPECT_EQ(parse_tag("-1"), 0u);
+    EXPECT_EQ(parse_tag("1234567890"), 0u);  // Longer than MAX_TAG_DIGITS
+    EXPECT_EQ(parse_tag("12/4"), 0u);        // '/' and ':' border the digits
+    EXPECT_EQ(parse_tag("12:4"), 0u);
+}
+
+TEST(ParseTagTest, EveryTableTag) {
+    // Run-time (SWAR) conversion agrees with the table range end to end
+    for (uint32_t tag = 1; tag < TAG_TABLE_SIZE; ++tag) {
+        EXPECT_EQ(parse_tag(std::to_string(tag)), tag);
+    }
+    EXPECT_EQ(parse_tag("0035"), 35u);
+}
+
+// ============================================================================
+// Lookup Tests
+// ============================================================================
+
+TEST_F(FieldIndexTest, LooksUpUnstoredTags) {
+    FIXMessage msg = parse_simd(EXECUTION_REPORT, context, fields);
+
+    ASSERT_TRUE(msg.valid);
+    EXPECT_EQ(fields.get(11), "ORD-1001");                 // ClOrdID
+    EXPECT_EQ(fields.get(37), "EX-77");                    // OrderID
+    EXPECT_EQ(fields.get(150), "F");                       // ExecType
+    EXPECT_EQ(fields.get(60), "20240115-14:30:00.123");    // TransactTime
+}
+
+TEST_F(FieldIndexTest, AgreesWithFIXMessage) {
+    FIXMessage msg = parse_simd(EXECUTION_REPORT, context, fields);
+
+    EXPECT_EQ(fields.get(35), msg.message_type);
+    EXPECT_EQ(fields.get(55), msg.symbol);
+    EXPECT_EQ(fields.get(49), msg.sender);
+    EXPECT_EQ(fields.get(56), msg.target);
+    EXPECT_EQ(parse_int(fields.get(38)), msg.quantity);
+    EXPECT_TRUE(msg.checksum_valid);
+    EXPECT_TRUE(fields.contains(10));
+}
+
+TEST_F(FieldIndexTest, ValuesAreViewsIntoMessage) {
+    parse_simd(EXECUTION_REPORT, context, fields);
+
+    std::string_view value = fields.get(11);
+    EXPECT_GE(value.data(), EXECUTION_REPORT.data());
+    EXPECT_LE(value.data() + value.size(), EXECUTION_REPORT.data() + EXECUTION_REPORT.size());
+}
+
+TEST_F(FieldIndexTest, MissingTag) {
+    parse_simd(EXECUTION_REPORT, context, fields);
+
+    EXPECT_FALSE(fields.contains(58));
+    EXPECT_TRUE(fields.get(58).empty());
+    EXPECT_FALSE(fields.contains(0));
+    EXPECT_FALSE(fields.contains(TAG_TABLE_SIZE + 5));
+}
+
+TEST_F(FieldIndexTest, NonNumericTagIsNeverFound) {
+    parse_simd("35=D|ab=X|55=AAPL|", context, fields);
+
+    EXPECT_FALSE(fields.contains(0));
+    EXPECT_EQ(fields.get(0).data(), nullptr);
+    EXPECT_EQ(fields.get(55), "AAPL");
+    // Still listed in wire order
+    ASSERT_EQ(fields.size(), 3u);
+    EXPECT_EQ(fields.fields()[1].tag, 0u);
+    EXPECT_EQ(fields.value(fields.fields()[1]), "X");
+}
+
+TEST_F(FieldIndexTest, EmptyValueIsPresent) {
+    parse_simd("35=D|58=|55=AAPL|", context, fields);
+
+    EXPECT_TRUE(fields.contains(58));
+    EXPECT_TRUE(fields.get(58).empty());
+}
+
+TEST_F(FieldIndexTest, LargeTags) {
+    parse_simd("35=D|20001=alpha|5000=beta|55=AAPL|", context, fields);
+
+    EXPECT_EQ(fields.get(20001), "alpha");
+    EXPECT_EQ(fields.get(5000), "beta");
+    EXPECT_FALSE(fields.contains(20002));
+}
+
+TEST_F(FieldIndexTest, ManyLargeTags) {
+    // More distinct large tags than the table starts with, plus a repeat
+    std::string message = "35=D|";
+    for (uint32_t tag = 20000; tag < 20300; ++tag) {
+        message += std::to_string(tag) + "=" + std::to_string(tag * 3) + "|";
+    }
+    message += "20007=repeat|55=AAPL|";
+    parse_simd(message, context, fields);
+
+    for (uint32_t tag = 20000; tag < 20300; ++tag) {
+        ASSERT_EQ(fields.get(tag), std::to_string(tag * 3)) << tag;
+    }
+    EXPECT_EQ(fields.get(20007), "60021");
+    EXPECT_EQ(fields.get(55), "AAPL");
+    EXPECT_FALSE(fields.contains(20300));
+    EXPECT_FALSE(fields.contains(19999));
+
+    // The next message sees none of them
+    parse_simd("35=D|20001=alpha|55=MSFT|", context, fields);
+    EXPECT_EQ(fields.get(20001), "alpha");
+    EXPECT_FALSE(fields.contains(20002));
+    EXPECT_FALSE(fields.contains(20299));
+}
+
+TEST_F(FieldIndexTest, RepeatedTagReturnsFirstOccurrence) {
+    parse_simd("35=X|268=2|269=0|270=1.5|269=1|270=1.6|55=AAPL|", context, fields);
+
+    EXPECT_EQ(fields.get(269), "0");
+    EXPECT_EQ(fields.get(270), "1.5");
+
+    // Every occurrence is still available in wire order
+    std::vector<std::string_view> prices;
+    for (const FieldIndex::Field& field : fields.fields()) {
+        if (field.tag == 270) {
+            prices.push_back(fields.value(field));
+        }
+    }
+    EXPECT_EQ(prices, (std::vector<std::string_view>{"1.5", "1.6"}));
+}
+
+TEST_F(FieldIndexTest, FieldsInWireOrder) {
+    parse_simd("35=D|55=AAPL|54=1|", context, fields);
+
+    ASSERT_EQ(fields.size(), 3u);
+    EXPECT_EQ(fields.fields()[0].tag, 35u);
+    EXPECT_EQ(fields.fields()[1].tag, 55u);
+    EXPECT_EQ(fields.fields()[2].tag, 54u);
+}
+
+// ============================================================================
+// Reuse Tests
+// ============================================================================
+
+TEST_F(FieldIndexTest, ReuseForgetsPreviousMessage) {
+    parse_simd(EXECUTION_REPORT, context, fields);
+    ASSERT_TRUE(fields.contains(11));
+
+    parse_simd(test_data::valid::NEW_ORDER_SINGLE, context, fields);
+
+    EXPECT_FALSE(fields.contains(11));
+    EXPECT_FALSE(fields.contains(150));
+    EXPECT_EQ(fields.get(55), "AAPL");
+    EXPECT_EQ(fields.message(), test_data::valid::NEW_ORDER_SINGLE);
+}
+
+TEST_F(FieldIndexTest, RejectedMessageLeavesIndexEmpty) {
+    parse_simd(EXECUTION_REPORT, context, fields);
+
+    // Truncated: shorter than its BodyLength
+    std::string truncated = EXECUTION_REPORT.substr(0, EXECUTION_REPORT.size() - 20);
+    FIXMessage msg = parse_simd(truncated, context, fields);
+
+    EXPECT_FALSE(msg.valid);
+    EXPECT_EQ(fields.size(), 0u);
+    EXPECT_FALSE(fields.contains(35));
+}
+
+TEST_F(FieldIndexTest, SOH) {
+    std::string wire = test_data::to_soh(EXECUTION_REPORT);
+    FIXMessage msg = parse_simd<SOH>(wire, context, fields);
+
+    ASSERT_TRUE(msg.valid);
+    EXPECT_EQ(fields.get(11), "ORD-1001");
+    EXPECT_EQ(fields.get(60), "20240115-14:30:00.123");
+}
+
+TEST_F(FieldIndexTest, SameResultAsPlainParse) {
+    for (const std::string& message : test_data::generate_message_batch(20)) {
+        FIXMessage indexed = parse_simd(message, context, fields);
+        FIXMessage plain = parse_simd(message);
+
+        EXPECT_EQ(indexed.valid, plain.valid);
+        EXPECT_EQ(indexed.symbol, plain.symbol);
+        EXPECT_EQ(indexed.side, plain.side);
+        EXPECT_EQ(indexed.quantity, plain.quantity);
+        EXPECT_DOUBLE_EQ(indexed.price(), plain.price());
+    }
+}
@@ -20,12 +20,14 @@ TEST(FIXMessageTest, DefaultConstruction) {
 
     EXPECT_TRUE(msg.message_type.empty());
     EXPECT_TRUE(msg.symbol.empty());
+    EXPECT_EQ(msg.symbol_id, NO_SYMBOL_ID);
     EXPECT_TRUE(msg.sender.empty());
     EXPECT_TRUE(msg.target.empty());
     EXPECT_EQ(msg.side, 0);
-    EXPECT_DOUBLE_EQ(msg.price, 0.0);
+    EXPECT_DOUBLE_EQ(msg.price(), 0.0);
     EXPECT_EQ(msg.quantity, 0);
     EXPECT_FALSE(msg.valid);
+    EXPECT_FALSE(msg.checksum_valid);
 }
 
 TEST(FIXMessageTest, DefaultConstruction_InvalidByDefault) {
@@ -47,6 +49,44 @@ TEST(FIXTagTest, TagValues) {
     EXPECT_EQ(static_cast<uint32_t>(FIXTag::Symbol), 55);
     EXPECT_EQ(static_cast<uint32_t>(FIXTag::OrderQty), 38);
     EXPECT_EQ(static_cast<uint32_t>(FIXTag::Price), 44);
+    EXPECT_EQ(static_cast<uint32_t>(FIXTag::CheckSum), 10);
+}
+
+// ============================================================================
+// Tag Dispatch Table Tests
+// ============================================================================
+
+TEST(FieldSlotTest, KnownTagsMapToSlots) {
+    static_assert(field_slot(35u) == FieldSlot::MessageType);
+    static_assert(field_slot("55") == FieldSlot::Symbol);
+
+    EXPECT_EQ(field_slot("35"), FieldSlot::MessageType);
+    EXPECT_EQ(field_slot("55"), FieldSlot::Symbol);
+    EXPECT_EQ(field_slot("49"), FieldSlot::Sender);
+    EXPECT_EQ(field_slot("56"), FieldSlot::Target);
+    EXPECT_EQ(field_slot("54"), FieldSlot::Side);
+    EXPECT_EQ(field_slot("44"), FieldSlot::Price);
+    EXPECT_EQ(field_slot("38"), FieldSlot::OrderQty);
+    EXPECT_EQ(field_slot("9"), FieldSlot::BodyLength);
+    EXPECT_EQ(field_slot("52"), FieldSlot::SendingTime);
+    EXPECT_EQ(field_slot("60"), FieldSlot::TransactTime);
+    EXPECT_EQ(field_slot("10"), FieldSlot::CheckSum);
+}
+
+TEST(FieldSlotTest, UnknownTagsMapToNone) {
+    EXPECT_EQ(field_slot("8"), FieldSlot::None);
+    EXPECT_EQ(field_slot("11"), FieldSlot::None);
+    EXPECT_EQ(field_slot("1023"), FieldSlot::None);
+    EXPECT_EQ(field_slot(TAG_TABLE_SIZE), FieldSlot::None);
+    EXPECT_EQ(field_slot(9999u), FieldSlot::None);
+}
+
+TEST(FieldSlotTest, MalformedTagDigitsMapToNone) {
+    EXPECT_EQ(field_slot(""), FieldSlot::None);
+    EXPECT_EQ(field_slot("3a"), FieldSlot::None);
+    EXPECT_EQ(field_slot("-35"), FieldSlot::None);
+    EXPECT_EQ(field_slot(" 35"), FieldSlot::None);
+    EXPECT_EQ(field_slot("10035"), FieldSlot::None);  // Five digits are never folded into the table
 }
 
 // ============================================================================
@@ -62,7 +102,7 @@ TEST(FIXMessageTest, AllFieldsPopulated) {
     EXPECT_FALSE(msg.sender.empty());
     EXPECT_FALSE(msg.target.empty());
     EXPECT_NE(msg.side, 0);
-    EXPECT_NE(msg.price, 0.0);
+    EXPECT_NE(msg.price(), 0.0);
     EXPECT_NE(msg.quantity, 0);
 }
 
@@ -161,25 +201,25 @@ TEST(FIXMessageTest, SenderTarget_Missing) {
 TEST(FIXMessageTest, Price_Standard) {
     auto msg = parse_auto(test_data::valid::NEW_ORDER_SINGLE);
 
-    EXPECT_DOUBLE_EQ(msg.price, 150.25);
+    EXPECT_DOUBLE_EQ(msg.price(), 150.25);
 }
 
 TEST(FIXMessageTest, Price_High) {
     auto msg = parse_auto(test_data::valid::HIGH_PRICE);
 
-    EXPECT_DOUBLE_EQ(msg.price, 628450.00);
+    EXPECT_DOUBLE_EQ(msg.price(), 628450.00);
 }
 
 TEST(FIXMessageTest, Price_Low) {
     auto msg = parse_auto(test_data::valid::LOW_PRICE);
 
-    EXPECT_NEAR(msg.price, 0.0025, 0.0001);
+    EXPECT_NEAR(msg.price(), 0.0025, 0.0001);
 }
 
 TEST(FIXMessageTest, Price_Missing) {
     auto msg = parse_auto("35=D|55=TEST|54=1|38=100|");
 
-    EXPECT_DOUBLE_EQ(msg.price, 0.0);
+    EXPECT_DOUBLE_EQ(msg.price(), 0.0);
 }
 
 // ============================================================================
@@ -264,7 +304,7 @@ TEST(FIXMessageTest, CopyConstruction) {
     EXPECT_EQ(copy.message_type, original.message_type);
     EXPECT_EQ(copy.symbol, original.symbol);
     EXPECT_EQ(copy.side, original.side);
-    EXPECT_EQ(copy.price, original.price);
+    EXPECT_EQ(copy.price(), original.price());
     EXPECT_EQ(copy.quantity, original.quantity);
     EXPECT_EQ(copy.valid, original.valid);
 }
@@ -0,0 +1,353 @@
+/**
+ * Stream Framer Unit Tests
+ *
+ * Tests for splitting concatenated FIX messages out of a byte stream.
+ */
+
+#include <gtest/gtest.h>
+#include "framer.hpp"
+#include "parser.hpp"
+#include "test_data.hpp"
+#include <string>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Test Fixtures
+// ============================================================================
+
+// Frames a buffer and returns the messages as owned strings
+template <char Delimiter = '|'>
+std::vector<std::string> frame_all(std::string_view buffer, bool end_of_stream, size_t* consumed = nullptr) {
+    std::vector<std::string_view> views(buffer.size() / 4 + 1);
+    FrameResult result = frame_messages<Delimiter>(buffer, views, end_of_stream);
+    if (consumed != nullptr) {
+        *consumed = result.consumed;
+    }
+    return {views.begin(), views.begin() + result.message_count};
+}
+
+// Appends a CheckSum trailer to a '|'-delimited message
+std::string with_trailer(const std::string& msg, const char* checksum = "123") {
+    return msg + "10=" + checksum + "|";
+}
+
+// ============================================================================
+// Messages Without Trailers
+// ============================================================================
+
+TEST(FramerTest, SplitsGluedMessages) {
+    const std::string& first = test_data::valid::NEW_ORDER_SINGLE;
+    const std::string& second = test_data::valid::EXECUTION_REPORT;
+    std::string buffer = first + second;
+
+    auto messages = frame_all(buffer, true);
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_EQ(messages[0], first);
+    EXPECT_EQ(messages[1], second);
+}
+
+TEST(FramerTest, HoldsBackLastMessageUntilEndOfStream) {
+    std::string buffer = test_data::valid::NEW_ORDER_SINGLE + test_data::valid::EXECUTION_REPORT;
+
+    size_t consumed = 0;
+    auto messages = frame_all(buffer, false, &consumed);
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0], test_data::valid::NEW_ORDER_SINGLE);
+    EXPECT_EQ(consumed, test_data::valid::NEW_ORDER_SINGLE.size());
+}
+
+TEST(FramerTest, IgnoresBeginStringInsideValues) {
+    // "8=FIX" not preceded by a delimiter and tags starting with 8 are not boundaries
+    std::string buffer = "8=FIX.4.4|35=D|58=8=FIX|80=1|55=AAPL|";
+
+    auto messages = frame_all(buffer, true);
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0], buffer);
+}
+
+TEST(FramerTest, AcceptsFixtBeginString) {
+    std::string first = "8=FIXT.1.1|35=D|55=AAPL|";
+    std::string second = "8=FIXT.1.1|35=8|55=MSFT|";
+
+    auto messages = frame_all(first + second, true);
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_EQ(messages[0], first);
+    EXPECT_EQ(messages[1], second);
+}
+
+// ============================================================================
+// Messages With CheckSum Trailers
+// ============================================================================
+
+TEST(FramerTest, TrailerCompletesMessage) {
+    std::string message = with_trailer(test_data::valid::NEW_ORDER_SINGLE);
+
+    size_t consumed = 0;
+    auto messages = frame_all(message, false, &consumed);
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0], message);
+    EXPECT_EQ(consumed, message.size());
+}
+
+TEST(FramerTest, OtherTagsStartingWithOneAreNotTrailers) {
+    std::string message = "8=FIX.4.4|11=ORD1|35=D|100=X|55=AAPL|10=042|";
+
+    auto messages = frame_all(message, false);
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0], message);
+}
+
+TEST(FramerTest, IncompleteChecksumIsHeldBack) {
+    std::string message = test_data::valid::NEW_ORDER_SINGLE + "10=12";
+
+    size_t consumed = 0;
+    auto messages = frame_all(message, false, &consumed);
+    EXPECT_TRUE(messages.empty());
+    EXPECT_EQ(consumed, 0);
+}
+
+TEST(FramerTest, SkipsBytesBetweenMessages) {
+    std::string first = with_trailer(test_data::valid::NEW_ORDER_SINGLE);
+    std::string second = with_trailer(test_data::valid::ORDER_CANCEL);
+    std::string buffer = "garbage|" + first + "junk|" + second + "xx";
+
+    size_t consumed = 0;
+    auto messages = frame_all(buffer, false, &consumed);
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_EQ(messages[0], first);
+    EXPECT_EQ(messages[1], second);
+    EXPECT_EQ(consumed, buffer.size() - 2);
+}
+
+TEST(FramerTest, KeepsSplitBeginString) {
+    std::string first = with_trailer(test_data::valid::NEW_ORDER_SINGLE);
+    std::string buffer = first + "8=FI";
+
+    size_t consumed = 0;
+    auto messages = frame_all(buffer, false, &consumed);
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(consumed, first.size());
+}
+
+// ============================================================================
+// Output Capacity and Streaming
+// ============================================================================
+
+TEST(FramerTest, StopsWhenOutputIsFull) {
+    std::string first = test_data::valid::NEW_ORDER_SINGLE;
+    std::string buffer = first + test_data::valid::EXECUTION_REPORT + test_data::valid::ORDER_CANCEL;
+
+    std::string_view out[1];
+    FrameResult result = frame_messages(buffer, out, true);
+    ASSERT_EQ(result.message_count, 1);
+    EXPECT_EQ(out[0], first);
+    EXPECT_EQ(result.consumed, first.size());
+}
+
+TEST(FramerTest, ReassemblesStreamAcrossReads) {
+    // Feed a long stream in odd-sized reads, carrying unconsumed bytes over
+    auto batch = test_data::generate_message_batch(500);
+    std::string stream;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        stream += (i % 3 == 0) ? with_trailer(batch[i]) : batch[i];
+    }
+
+    std::vector<std::string> framed;
+    std::string pending;
+    std::vector<std::string_view> out(64);
+    for (size_t offset = 0; offset < stream.size(); offset += 997) {
+        pending += stream.substr(offset, 997);
+        bool end_of_stream = offset + 997 >= stream.size();
+        FrameResult result;
+        do {
+            result = frame_messages(pending, out, end_of_stream);
+            for (size_t i = 0; i < result.message_count; ++i) {
+                framed.emplace_back(out[i]);
+            }
+            pending.erase(0, result.consumed);
+        } while (result.message_count == out.size());
+    }
+
+    ASSERT_EQ(framed.size(), batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        std::string expected = (i % 3 == 0) ? with_trailer(batch[i]) : batch[i];
+        EXPECT_EQ(framed[i], expected) << "message " << i;
+    }
+}
+
+TEST(FramerTest, FramedMessagesParse) {
+    std::string buffer = test_data::valid::NEW_ORDER_SINGLE + test_data::valid::EXECUTION_REPORT;
+
+    auto messages = frame_all(buffer, true);
+    ASSERT_EQ(messages.size(), 2);
+
+    FIXMessage first = parse_simd(messages[0]);
+    FIXMessage second = parse_simd(messages[1]);
+    EXPECT_EQ(first.symbol, "AAPL");
+    EXPECT_EQ(first.side, 1);
+    EXPECT_EQ(second.symbol, "MSFT");
+    EXPECT_EQ(second.side, 2);
+}
+
+// ============================================================================
+// BodyLength Header Tests
+// ============================================================================
+
+TEST(BodyLengthTest, LocatesBody) {
+    std::string msg = test_data::with_header("35=D|55=AAPL|");
+
+    BodyLocation location;
+    ASSERT_EQ(locate_body(msg, location), FrameStatus::Complete);
+    EXPECT_EQ(location.body_start, std::string("8=FIX.4.4|9=13|").size());
+    EXPECT_EQ(location.body_length, 13);
+    EXPECT_EQ(msg.substr(location.body_end()), msg.substr(msg.size() - CHECKSUM_FIELD_SIZE));
+}
+
+TEST(BodyLengthTest, HeaderPrefixesAreIncomplete) {
+    const std::string header = "8=FIX.4.4|9=13|";
+
+    BodyLocation location;
+    for (size_t size = 0; size < header.size(); ++size) {
+        EXPECT_EQ(locate_body(header.substr(0, size), location), FrameStatus::Incomplete)
+            << "Prefix: " << header.substr(0, size);
+    }
+}
+
+TEST(BodyLengthTest, MalformedHeaders) {
+    BodyLocation location;
+    for (const char* header : {"35=D|", "8=FIX.4.4|35=D|", "8=FIX.4.4|9=|", "8=FIX.4.4|9=1x|",
+                               "8=FIX.4.4|9=1234567890|", "9=13|8=FIX.4.4|"}) {
+        EXPECT_EQ(locate_body(header, location), FrameStatus::Malformed) << header;
+    }
+}
+
+TEST(BodyLengthTest, ExtentFromHeaderAlone) {
+    std::string msg = test_data::with_header("35=D|55=AAPL|54=1|38=100|");
+
+    size_t length = 0;
+    ASSERT_EQ(message_extent(msg, length), FrameStatus::Complete);
+    EXPECT_EQ(length, msg.size());
+
+    // Once the header is in, every shorter prefix knows the full size
+    BodyLocation location;
+    ASSERT_EQ(locate_body(msg, location), FrameStatus::Complete);
+    for (size_t size = location.body_start; size < msg.size(); ++size) {
+        EXPECT_EQ(message_extent(msg.substr(0, size), length), FrameStatus::Incomplete) << size;
+        EXPECT_EQ(length, msg.size()) << size;
+    }
+}
+
+TEST(BodyLengthTest, WrongBodyLengthIsMalformed) {
+    std::string msg = test_data::with_header("35=D|55=AAPL|");
+    std::string too_short = msg;
+    too_short.replace(too_short.find("9=13"), 4, "9=12");
+    std::string too_long = msg;
+    too_long.replace(too_long.find("9=13"), 4, "9=15");
+
+    size_t length = 0;
+    EXPECT_EQ(message_extent(too_short, length), FrameStatus::Malformed);
+    EXPECT_EQ(message_extent(too_long, length), FrameStatus::Malformed);
+}
+
+// ============================================================================
+// Length-Driven Framing Tests
+// ============================================================================
+
+TEST(FrameByLengthTest, SplitsStreamAndReportsBytesNeeded) {
+    auto batch = test_data::generate_message_batch(50);
+    std::vector<std::string> messages;
+    std::string stream;
+    for (const auto& msg : batch) {
+        // Strip "8=FIX.4.4|" and rebuild with a real header and trailer
+        messages.push_back(test_data::with_header(msg.substr(10)));
+        stream += messages.back();
+    }
+    const size_t partial = 23;
+    std::string buffer = stream + messages[0].substr(0, partial);
+
+    std::vector<std::string_view> out(64);
+    FrameResult result = frame_messages_by_length(buffer, out);
+
+    ASSERT_EQ(result.message_count, messages.size());
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(out[i], messages[i]) << "message " << i;
+    }
+    EXPECT_EQ(result.consumed, stream.size());
+    EXPECT_EQ(result.bytes_needed, messages[0].size());
+}
+
+TEST(FrameByLengthTest, BytesNeededUnknownInsideHeader) {
+    std::string msg = test_data::with_header("35=D|55=AAPL|");
+
+    std::string_view out[1];
+    FrameResult result = frame_messages_by_length(std::string_view(msg).substr(0, 12), out);
+    EXPECT_EQ(result.message_count, 0);
+    EXPECT_EQ(result.consumed, 0);
+    EXPECT_EQ(result.bytes_needed, 0);
+}
+
+TEST(FrameByLengthTest, ResynchronisesAfterGarbage) {
+    std::string first = test_data::with_header("35=D|55=AAPL|");
+    std::string second = test_data::with_header("35=8|55=MSFT|");
+    std::string corrupt = first;
+    corrupt.replace(corrupt.find("9=13"), 4, "9=14");
+
+    std::string buffer = "junk|" + first + corrupt + second;
+    std::vector<std::string_view> out(4);
+    FrameResult result = frame_messages_by_length(buffer, out);
+
+    ASSERT_EQ(result.message_count, 2);
+    EXPECT_EQ(out[0], first);
+    EXPECT_EQ(out[1], second);
+    EXPECT_EQ(result.consumed, buffer.size());
+}
+
+TEST(FrameByLengthTest, StopsWhenOutputIsFull) {
+    std::string first = test_data::with_header("35=D|55=AAPL|");
+    std::string buffer = first + test_data::with_header("35=8|55=MSFT|");
+
+    std::string_view out[1];
+    FrameResult result = frame_messages_by_length(buffer, out);
+    ASSERT_EQ(result.message_count, 1);
+    EXPECT_EQ(result.consumed, first.size());
+}
+
+TEST(FrameByLengthTest, SOH) {
+    std::string first = test_data::with_header(test_data::to_soh("35=D|55=AAPL|"), SOH);
+    std::string second = test_data::with_header(test_data::to_soh("35=8|55=MSFT|"), SOH);
+
+    std::string buffer = first + second;
+
+    std::string_view out[2];
+    FrameResult result = frame_messages_by_length<SOH>(buffer, out);
+    ASSERT_EQ(result.message_count, 2);
+    EXPECT_EQ(out[0], first);
+    EXPECT_EQ(out[1], second);
+    EXPECT_TRUE(parse_simd<SOH>(out[1]).checksum_valid);
+}
+
+// ============================================================================
+// SOH Delimiter
+// ============================================================================
+
+TEST(FramerTest, SplitsSohStream) {
+    std::string first = test_data::to_soh(with_trailer(test_data::valid::NEW_ORDER_SINGLE));
+    std::string second = test_data::to_soh(test_data::valid::EXECUTION_REPORT);
+
+    auto messages = frame_all<SOH>(first + second, true);
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_EQ(messages[0], first);
+    EXPECT_EQ(messages[1], second);
+
+    // A '|' framer sees no boundaries in SOH data
+    EXPECT_EQ(frame_all(first + second, true).size(), 1);
+}
+
+TEST(FramerTest, EmptyBuffer) {
+    size_t consumed = 1;
+    auto messages = frame_all("", true, &consumed);
+    EXPECT_TRUE(messages.empty());
+    EXPECT_EQ(consumed, 0);
+}
@@ -0,0 +1,132 @@
+/**
+ * Lazy Message Unit Tests
+ *
+ * Tests for parse_lazy(): offsets recorded during the scan, numeric fields
+ * converted on first access.
+ */
+
+#include <gtest/gtest.h>
+#include "lazy_message.hpp"
+#include "parser.hpp"
+#include "test_data.hpp"
+#include <string>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Deferred Conversion Tests
+// ============================================================================
+
+TEST(LazyMessageTest, StringFieldsNeedNoConversion) {
+    auto msg = parse_lazy(test_data::valid::NEW_ORDER_SINGLE);
+
+    EXPECT_TRUE(msg.valid());
+    EXPECT_EQ(msg.message_type(), "D");
+    EXPECT_EQ(msg.target(), "TARGET");
+
+    // Routing never touched the numeric fields
+    EXPECT_FALSE(msg.is_decoded(FieldSlot::Price));
+    EXPECT_FALSE(msg.is_decoded(FieldSlot::OrderQty));
+    EXPECT_FALSE(msg.is_decoded(FieldSlot::Side));
+}
+
+TEST(LazyMessageTest, NumericFieldsDecodedOnFirstAccess) {
+    auto msg = parse_lazy(test_data::valid::NEW_ORDER_SINGLE);
+
+    EXPECT_DOUBLE_EQ(msg.price(), 150.25);
+    EXPECT_TRUE(msg.is_decoded(FieldSlot::Price));
+    EXPECT_FALSE(msg.is_decoded(FieldSlot::OrderQty));
+
+    EXPECT_EQ(msg.quantity(), 100);
+    EXPECT_EQ(msg.side(), 1);
+    EXPECT_TRUE(msg.is_decoded(FieldSlot::OrderQty));
+    EXPECT_TRUE(msg.is_decoded(FieldSlot::Side));
+
+    // Cached values are returned again
+    EXPECT_DOUBLE_EQ(msg.price(), 150.25);
+    EXPECT_EQ(msg.price_decimal(), (Decimal64{15025, -2}));
+    EXPECT_EQ(msg.quantity(), 100);
+}
+
+TEST(LazyMessageTest, MissingFieldsReadAsZero) {
+    auto msg = parse_lazy(test_data::valid::MINIMAL);
+
+    EXPECT_TRUE(msg.valid());
+    EXPECT_EQ(msg.side(), 0);
+    EXPECT_DOUBLE_EQ(msg.price(), 0.0);
+    EXPECT_TRUE(msg.sender().empty());
+}
+
+// ============================================================================
+// Equivalence Tests
+// ============================================================================
+
+TEST(LazyMessageTest, MatchesEagerParse) {
+    std::string with_trailer = test_data::with_header(
+        "35=D|49=A|56=B|52=20240115-14:30:00.123|55=NVDA|54=2|38=1000|44=875.30|");
+    std::vector<std::string> messages = test_data::generate_message_batch(10);
+    messages.push_back(test_data::valid::FULL_MESSAGE);
+    messages.push_back(with_trailer);
+    messages.push_back(test_data::invalid::NO_SYMBOL);
+
+    for (const std::string& message : messages) {
+        FIXMessage eager = parse_simd(message);
+        FIXMessage lazy = parse_lazy(message).to_message();
+
+        EXPECT_EQ(lazy.message_type, eager.message_type);
+        EXPECT_EQ(lazy.symbol, eager.symbol);
+        EXPECT_EQ(lazy.sender, eager.sender);
+        EXPECT_EQ(lazy.target, eager.target);
+        EXPECT_EQ(lazy.side, eager.side);
+        EXPECT_DOUBLE_EQ(lazy.price(), eager.price());
+        EXPECT_EQ(lazy.price_decimal, eager.price_decimal);
+        EXPECT_EQ(lazy.quantity, eager.quantity);
+        EXPECT_EQ(lazy.body_length, eager.body_length);
+        EXPECT_EQ(lazy.sending_time, eager.sending_time);
+        EXPECT_EQ(lazy.transact_time, eager.transact_time);
+        EXPECT_EQ(lazy.valid, eager.valid);
+        EXPECT_EQ(lazy.checksum_valid, eager.checksum_valid);
+    }
+}
+
+TEST(LazyMessageTest, ChecksumValidatedDuringScan) {
+    std::string msg = test_data::with_header("35=D|55=AAPL|44=1.5|");
+    EXPECT_TRUE(parse_lazy(msg).checksum_valid());
+
+    msg[msg.find("AAPL")] = 'B';
+    EXPECT_FALSE(parse_lazy(msg).checksum_valid());
+}
+
+TEST(LazyMessageTest, TruncatedMessageEmpty) {
+    std::string msg = test_data::with_header("35=D|55=AAPL|44=1.5|");
+    auto lazy = parse_lazy(std::string_view(msg).substr(0, msg.size() - 10));
+
+    EXPECT_FALSE(lazy.valid());
+    EXPECT_TRUE(lazy.message_type().empty());
+}
+
+TEST(LazyMessageTest, TruncatedMessageKeepsBodyLength) {
+    std::string msg = "8=FIX.4.4|9=200|35=D|55=AAPL|44=1.5|";
+    auto lazy = parse_lazy(msg);
+    FIXMessage eager = parse_simd(msg);
+
+    EXPECT_FALSE(lazy.valid());
+    EXPECT_EQ(lazy.body_length(), 200);
+    EXPECT_EQ(lazy.to_message().body_length, eager.body_length);
+    EXPECT_EQ(lazy.to_message().valid, eager.valid);
+    EXPECT_TRUE(lazy.symbol().empty());
+
+    std::string wire = test_data::to_soh(msg);
+    EXPECT_EQ(parse_lazy<SOH>(wire).body_length(), 200);
+}
+
+TEST(LazyMessageTest, SOH) {
+    std::string wire = test_data::to_soh(test_data::valid::EXECUTION_REPORT);
+    ParserContext context;
+    auto msg = parse_lazy<SOH>(wire, context);
+
+    EXPECT_TRUE(msg.valid());
+    EXPECT_EQ(msg.symbol(), "MSFT");
+    EXPECT_DOUBLE_EQ(msg.price(), 378.50);
+}
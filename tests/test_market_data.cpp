@@ -0,0 +1,189 @@
+/**
+ * Market Data Unit Tests
+ *
+ * Tests for parsing MarketDataIncrementalRefresh (35=X) NoMDEntries groups
+ * into struct-of-arrays columns.
+ */
+
+#include <gtest/gtest.h>
+#include "market_data.hpp"
+#include "parser.hpp"
+#include "test_data.hpp"
+#include <string>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Test Fixtures
+// ============================================================================
+
+class MarketDataTest : public ::testing::Test {
+protected:
+    ParserContext context;
+    MarketDataEntries entries;
+};
+
+// Three updates: new bid, changed offer, deleted bid
+inline const std::string REFRESH = test_data::with_header(
+    "35=X|49=EXCHANGE|56=CLIENT|34=12|262=REQ-1|268=3|"
+    "279=0|269=0|55=AAPL|270=150.25|271=100|"
+    "279=1|269=1|55=AAPL|270=150.30|271=250|"
+    "279=2|269=0|55=AAPL|270=150.20|");
+
+// Builds a refresh with `count` New bid entries at increasing prices
+inline std::string generate_refresh(size_t count) {
+    std::string body = "35=X|49=EXCHANGE|56=CLIENT|268=" + std::to_string(count) + "|";
+    for (size_t i = 0; i < count; ++i) {
+        body += "279=0|269=0|55=MSFT|270=" + std::to_string(100 + i) + ".5|271=" +
+                std::to_string((i + 1) * 10) + "|";
+    }
+    return test_data::with_header(body);
+}
+
+// ============================================================================
+// Group Parsing Tests
+// ============================================================================
+
+TEST_F(MarketDataTest, ParsesEntriesIntoColumns) {
+    FIXMessage msg = parse_market_data(REFRESH, context, entries);
+
+    ASSERT_TRUE(msg.valid);
+    EXPECT_TRUE(msg.checksum_valid);
+    EXPECT_EQ(msg.message_type, "X");
+    EXPECT_EQ(msg.sender, "EXCHANGE");
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries.declared_count, 3);
+
+    EXPECT_EQ(entries.action(0), MDUpdateAction::New);
+    EXPECT_EQ(entries.action(1), MDUpdateAction::Change);
+    EXPECT_EQ(entries.action(2), MDUpdateAction::Delete);
+
+    EXPECT_EQ(entries.entry_types[0], '0');
+    EXPECT_EQ(entries.entry_types[1], '1');
+    EXPECT_EQ(entries.entry_types[2], '0');
+
+    EXPECT_DOUBLE_EQ(entries.prices[0], 150.25);
+    EXPECT_DOUBLE_EQ(entries.prices[1], 150.30);
+    EXPECT_DOUBLE_EQ(entries.prices[2], 150.20);
+
+    EXPECT_DOUBLE_EQ(entries.sizes[0], 100.0);
+    EXPECT_DOUBLE_EQ(entries.sizes[1], 250.0);
+
+    EXPECT_EQ(entries.symbols[0], "AAPL");
+    EXPECT_EQ(entries.symbols[2], "AAPL");
+}
+
+TEST_F(MarketDataTest, MissingFieldKeepsDefault) {
+    parse_market_data(REFRESH, context, entries);
+
+    // The Delete entry carries no MDEntrySize
+    EXPECT_DOUBLE_EQ(entries.sizes[2], 0.0);
+}
+
+TEST_F(MarketDataTest, UnstoredGroupFieldsSkipped) {
+    std::string msg = test_data::with_header(
+        "35=X|268=2|279=0|269=0|278=ID1|270=10.5|273=14:30:00|"
+        "279=1|269=1|278=ID2|270=10.6|");
+    FIXMessage result = parse_market_data(msg, context, entries);
+
+    ASSERT_TRUE(result.valid);
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_DOUBLE_EQ(entries.prices[0], 10.5);
+    EXPECT_DOUBLE_EQ(entries.prices[1], 10.6);
+}
+
+TEST_F(MarketDataTest, FirstGroupTagDelimitsEntries) {
+    // Entries led by MDEntryType instead of MDUpdateAction
+    std::string msg = test_data::with_header("35=X|268=2|269=0|270=1.5|269=1|270=1.6|");
+    FIXMessage result = parse_market_data(msg, context, entries);
+
+    ASSERT_TRUE(result.valid);
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries.entry_types[1], '1');
+    EXPECT_DOUBLE_EQ(entries.prices[1], 1.6);
+}
+
+TEST_F(MarketDataTest, SOH) {
+    std::string wire = test_data::to_soh(REFRESH);
+    FIXMessage msg = parse_market_data<SOH>(wire, context, entries);
+
+    ASSERT_TRUE(msg.valid);
+    EXPECT_EQ(entries.size(), 3u);
+    EXPECT_DOUBLE_EQ(entries.prices[1], 150.30);
+}
+
+TEST_F(MarketDataTest, ManyEntriesAcrossBlocks) {
+    std::string msg = generate_refresh(40);
+    FIXMessage result = parse_market_data(msg, context, entries);
+
+    ASSERT_TRUE(result.valid);
+    ASSERT_EQ(entries.size(), 40u);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        EXPECT_DOUBLE_EQ(entries.prices[i], 100.5 + static_cast<double>(i));
+        EXPECT_DOUBLE_EQ(entries.sizes[i], static_cast<double>((i + 1) * 10));
+        EXPECT_EQ(entries.symbols[i], "MSFT");
+    }
+}
+
+// ============================================================================
+// Column Padding Tests
+// ============================================================================
+
+TEST_F(MarketDataTest, ColumnsPaddedToVectorWidth) {
+    parse_market_data(REFRESH, context, entries);
+
+    EXPECT_EQ(entries.padded_size(), MarketDataEntries::COLUMN_PADDING);
+    EXPECT_EQ(entries.prices.size(), entries.padded_size());
+    EXPECT_EQ(entries.sizes.size(), entries.padded_size());
+    EXPECT_EQ(entries.actions.size(), entries.padded_size());
+
+    // Full-width loops can run over the padding: it contributes nothing
+    double notional = 0.0;
+    for (size_t i = 0; i < entries.padded_size(); ++i) {
+        notional += entries.prices[i] * entries.sizes[i];
+    }
+    EXPECT_DOUBLE_EQ(notional, 150.25 * 100 + 150.30 * 250);
+}
+
+TEST_F(MarketDataTest, ExactMultipleNotPadded) {
+    parse_market_data(generate_refresh(16), context, entries);
+
+    EXPECT_EQ(entries.padded_size(), 16u);
+    EXPECT_EQ(entries.prices.size(), 16u);
+}
+
+// ============================================================================
+// Validation Tests
+// ============================================================================
+
+TEST_F(MarketDataTest, CountMismatchInvalid) {
+    std::string msg = test_data::with_header("35=X|268=3|279=0|270=1.5|279=0|270=1.6|");
+    FIXMessage result = parse_market_data(msg, context, entries);
+
+    EXPECT_FALSE(result.valid);
+    EXPECT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries.declared_count, 3);
+}
+
+TEST_F(MarketDataTest, WrongMessageTypeInvalid) {
+    std::string msg = test_data::with_header("35=W|268=1|279=0|270=1.5|");
+
+    EXPECT_FALSE(parse_market_data(msg, context, entries).valid);
+}
+
+TEST_F(MarketDataTest, TruncatedMessageRejected) {
+    std::string truncated = REFRESH.substr(0, REFRESH.size() - 30);
+    FIXMessage result = parse_market_data(truncated, context, entries);
+
+    EXPECT_FALSE(result.valid);
+    EXPECT_TRUE(entries.empty());
+}
+
+TEST_F(MarketDataTest, ReuseClearsPreviousEntries) {
+    parse_market_data(generate_refresh(20), context, entries);
+    parse_market_data(REFRESH, context, entries);
+
+    EXPECT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries.prices.size(), MarketDataEntries::COLUMN_PADDING);
+    EXPECT_DOUBLE_EQ(entries.prices[3], 0.0);
+}
@@ -0,0 +1,142 @@
+/**
+ * Message Batch Unit Tests
+ *
+ * Tests for parse_batch(): framing a receive buffer and parsing it into
+ * struct-of-arrays columns.
+ */
+
+#include <gtest/gtest.h>
+#include "message_batch.hpp"
+#include "parser.hpp"
+#include "test_data.hpp"
+#include <string>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Column Tests
+// ============================================================================
+
+TEST(MessageBatchTest, PackMsgType) {
+    static_assert(pack_msg_type("D") == 0x0044);
+    EXPECT_EQ(pack_msg_type("AE"), 0x4541);
+    EXPECT_EQ(pack_msg_type(""), 0);
+    EXPECT_EQ(pack_msg_type("U100"), LONG_MSG_TYPE);
+}
+
+TEST(MessageBatchTest, RowsMatchParseSIMD) {
+    const std::string stream = test_data::generate_message_stream(103);
+    ParserContext context;
+    MessageBatch batch;
+
+    FrameResult result = parse_batch(stream, context, batch, true);
+
+    ASSERT_EQ(result.message_count, 103u);
+    EXPECT_EQ(result.consumed, stream.size());
+    ASSERT_EQ(batch.size(), 103u);
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        FIXMessage expected = parse_simd(batch.message(i), context);
+        EXPECT_EQ(batch.msg_types[i], pack_msg_type(expected.message_type)) << "Message " << i;
+        EXPECT_EQ(batch.symbol(i), expected.symbol) << "Message " << i;
+        EXPECT_EQ(batch.sides[i], expected.side) << "Message " << i;
+        EXPECT_EQ(batch.prices[i], expected.price()) << "Message " << i;
+        EXPECT_EQ(batch.quantities[i], expected.quantity) << "Message " << i;
+        EXPECT_EQ(batch.valid[i] != 0, expected.valid) << "Message " << i;
+        EXPECT_EQ(batch.checksum_valid[i] != 0, expected.checksum_valid) << "Message " << i;
+        EXPECT_EQ(batch.symbol_ids[i], NO_SYMBOL_ID) << "Message " << i;
+    }
+    EXPECT_EQ(batch.symbol(2), "ESZ4 Comdty");
+    EXPECT_FALSE(batch.valid[4]);
+}
+
+TEST(MessageBatchTest, ColumnsPaddedWithDefaults) {
+    const std::string stream = test_data::generate_message_stream(3);
+    MessageBatch batch;
+
+    parse_batch(stream, batch, true);
+
+    ASSERT_EQ(batch.size(), 3u);
+    ASSERT_EQ(batch.padded_size(), MessageBatch::COLUMN_PADDING);
+    EXPECT_EQ(batch.prices.size(), batch.padded_size());
+    EXPECT_EQ(batch.msg_types.size(), batch.padded_size());
+    for (size_t i = batch.size(); i < batch.padded_size(); ++i) {
+        EXPECT_EQ(batch.prices[i], 0.0);
+        EXPECT_EQ(batch.quantities[i], 0);
+        EXPECT_EQ(batch.valid[i], 0);
+        EXPECT_EQ(batch.symbol_ids[i], NO_SYMBOL_ID);
+    }
+}
+
+TEST(MessageBatchTest, SymbolIdsFromContextTable) {
+    const std::string stream = test_data::generate_message_stream(20);
+    SymbolTable symbols;
+    ParserContext context;
+    context.symbols = &symbols;
+    MessageBatch batch;
+
+    parse_batch(stream, context, batch, true);
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (batch.symbol(i).empty()) {
+            EXPECT_EQ(batch.symbol_ids[i], NO_SYMBOL_ID) << "Message " << i;
+        } else {
+            EXPECT_EQ(symbols.name(batch.symbol_ids[i]), batch.symbol(i)) << "Message " << i;
+        }
+    }
+    EXPECT_EQ(symbols.size(), 4u);
+}
+
+// ============================================================================
+// Framing Tests
+// ============================================================================
+
+TEST(MessageBatchTest, IncompleteTailHeldBack) {
+    const std::string complete = test_data::generate_message_stream(40);
+    const std::string next = test_data::generate_message_stream(1);
+    const std::string stream = complete + next.substr(0, next.size() / 2);
+    MessageBatch batch;
+
+    FrameResult result = parse_batch(stream, batch);
+
+    EXPECT_EQ(result.message_count, 40u);
+    EXPECT_EQ(result.consumed, complete.size());
+    EXPECT_EQ(batch.size(), 40u);
+}
+
+TEST(MessageBatchTest, EmptyBuffer) {
+    MessageBatch batch;
+    FrameResult result = parse_batch("", batch, true);
+
+    EXPECT_EQ(result.message_count, 0u);
+    EXPECT_EQ(result.consumed, 0u);
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.padded_size(), 0u);
+}
+
+TEST(MessageBatchTest, ReuseResetsColumns) {
+    MessageBatch batch;
+    const std::string first = test_data::generate_message_stream(30);
+    const std::string second = test_data::generate_message_stream(2);
+
+    parse_batch(first, batch, true);
+    parse_batch(second, batch, true);
+
+    EXPECT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch.buffer.data(), second.data());
+    EXPECT_EQ(batch.symbol(1), "MSFT");
+}
+
+TEST(MessageBatchTest, SOH) {
+    const std::string stream = test_data::generate_message_stream(17, SOH);
+    MessageBatch batch;
+
+    FrameResult result = parse_batch<SOH>(stream, batch, true);
+
+    ASSERT_EQ(result.message_count, 17u);
+    EXPECT_EQ(batch.symbol(0), "AAPL");
+    EXPECT_DOUBLE_EQ(batch.prices[1], 378.5);
+    EXPECT_EQ(batch.quantities[15], 100);
+    EXPECT_TRUE(batch.checksum_valid[16]);
+}
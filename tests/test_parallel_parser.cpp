@@ -0,0 +1,189 @@
+/**
+ * Parallel Parser Unit Tests
+ *
+ * Tests for the work-stealing ThreadPool and for ParallelParser: results
+ * must match single-threaded parsing, in input order.
+ */
+
+#include <gtest/gtest.h>
+#include "parallel_parser.hpp"
+#include "test_data.hpp"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Test Fixtures
+// ============================================================================
+
+void expect_same(const FIXMessage& actual, const FIXMessage& expected, size_t i) {
+    EXPECT_EQ(actual.message_type, expected.message_type) << "Message " << i;
+    EXPECT_EQ(actual.symbol, expected.symbol) << "Message " << i;
+    if (!expected.symbol.empty()) {
+        EXPECT_EQ(actual.symbol.data(), expected.symbol.data()) << "Message " << i;
+    }
+    EXPECT_EQ(actual.side, expected.side) << "Message " << i;
+    EXPECT_EQ(actual.price(), expected.price()) << "Message " << i;
+    EXPECT_EQ(actual.quantity, expected.quantity) << "Message " << i;
+    EXPECT_EQ(actual.sending_time, expected.sending_time) << "Message " << i;
+    EXPECT_EQ(actual.valid, expected.valid) << "Message " << i;
+    EXPECT_EQ(actual.checksum_valid, expected.checksum_valid) << "Message " << i;
+}
+
+// ============================================================================
+// Thread Pool Tests
+// ============================================================================
+
+TEST(ThreadPoolTest, EveryTaskRunsOnce) {
+    ThreadPool pool(4);
+    ASSERT_EQ(pool.size(), 4u);
+
+    for (size_t count : {0u, 1u, 3u, 4u, 5u, 100u, 1001u}) {
+        std::vector<std::atomic<int>> runs(count);
+        pool.run(count, [&](size_t task, size_t worker) {
+            EXPECT_LT(worker, pool.size());
+            runs[task].fetch_add(1, std::memory_order_relaxed);
+        });
+
+        size_t tasks = 0;
+        for (const ThreadPool::WorkerCounters& counters : pool.counters()) {
+            tasks += counters.tasks;
+        }
+        EXPECT_EQ(tasks, count) << "Count " << count;
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(runs[i].load(), 1) << "Count " << count << ", task " << i;
+        }
+    }
+}
+
+TEST(ThreadPoolTest, DefaultUsesAtLeastOneThread) {
+    ThreadPool pool;
+    EXPECT_GE(pool.size(), 1u);
+
+    std::atomic<size_t> sum{0};
+    pool.run(10, [&](size_t task, size_t) { sum += task; });
+    EXPECT_EQ(sum.load(), 45u);
+}
+
+TEST(ThreadPoolTest, SlowWorkerGetsRobbed) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> runs(64);
+
+    // Worker 0 starts with tasks 0..15, each of which is slow
+    pool.run(runs.size(), [&](size_t task, size_t) {
+        if (task < 16) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        runs[task].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    size_t steals = 0;
+    for (const ThreadPool::WorkerCounters& counters : pool.counters()) {
+        steals += counters.steals;
+    }
+    EXPECT_GT(steals, 0u);
+    for (size_t i = 0; i < runs.size(); ++i) {
+        EXPECT_EQ(runs[i].load(), 1) << "Task " << i;
+    }
+}
+
+// ============================================================================
+// Parallel Parser Tests
+// ============================================================================
+
+TEST(ParallelParserTest, ParseMatchesParseSIMD) {
+    const std::string stream = test_data::generate_message_stream(3 * ParallelParser::CHUNK_MESSAGES + 17);
+    const std::vector<std::string_view> messages = test_data::frame_stream<'|'>(stream);
+    ParallelParser parser(4);
+    std::vector<FIXMessage> results(messages.size());
+
+    ParallelParseStats stats = parser.parse(messages, results);
+
+    ASSERT_EQ(stats.workers.size(), 4u);
+    EXPECT_EQ(stats.messages(), messages.size());
+    EXPECT_EQ(stats.bytes(), stream.size());
+    for (size_t i = 0; i < messages.size(); ++i) {
+        expect_same(results[i], parse_simd(messages[i]), i);
+    }
+}
+
+TEST(ParallelParserTest, ParseBufferMatchesSequential) {
+    const std::string stream = test_data::generate_message_stream(5000);
+    ASSERT_GT(stream.size(), 3 * ParallelParser::CHUNK_BYTES);
+    const std::vector<std::string_view> expected = test_data::frame_stream<'|'>(stream);
+    ParallelParser parser(3);
+    std::vector<FIXMessage> results;
+
+    ParallelParseStats stats = parser.parse_buffer(stream, results);
+
+    ASSERT_EQ(results.size(), expected.size());
+    EXPECT_EQ(stats.messages(), expected.size());
+    size_t chunks = 0;
+    for (const ParseWorkerStats& worker : stats.workers) {
+        chunks += worker.tasks;
+    }
+    EXPECT_GT(chunks, 3u);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        expect_same(results[i], parse_simd(expected[i]), i);
+    }
+}
+
+TEST(ParallelParserTest, ParseBufferReuse) {
+    ParallelParser parser(2);
+    std::vector<FIXMessage> results;
+    const std::string large = test_data::generate_message_stream(3000);
+    const std::string small = test_data::generate_message_stream(4);
+
+    parser.parse_buffer(large, results);
+    parser.parse_buffer(small, results);
+
+    ASSERT_EQ(results.size(), 4u);
+    EXPECT_EQ(results[0].symbol, "AAPL");
+    EXPECT_EQ(results[3].symbol, "GOOGL");
+    EXPECT_EQ(results[0].symbol.data(), small.data() + small.find("AAPL"));
+}
+
+TEST(ParallelParserTest, SOH) {
+    const std::string stream = test_data::generate_message_stream(2000, SOH);
+    const std::vector<std::string_view> expected = test_data::frame_stream<SOH>(stream);
+    ParallelParser parser(4);
+    std::vector<FIXMessage> results;
+
+    parser.parse_buffer<SOH>(stream, results);
+
+    ASSERT_EQ(results.size(), 2000u);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        expect_same(results[i], parse_simd<SOH>(expected[i]), i);
+    }
+    EXPECT_TRUE(results[1].checksum_valid);
+    EXPECT_NE(results[3].sending_time, 0);
+}
+
+TEST(ParallelParserTest, EmptyInput) {
+    ParallelParser parser(2);
+    std::vector<FIXMessage> results(1);
+
+    ParallelParseStats stats = parser.parse_buffer("", results);
+
+    EXPECT_TRUE(results.empty());
+    EXPECT_EQ(stats.messages(), 0u);
+    EXPECT_EQ(parser.parse({}, {}).messages(), 0u);
+}
+
+TEST(ParallelParserTest, Report) {
+    const std::string stream = test_data::generate_message_stream(1000);
+    ParallelParser parser(2);
+    std::vector<FIXMessage> results;
+
+    ParallelParseStats stats = parser.parse_buffer(stream, results);
+    const std::string report = stats.report();
+
+    EXPECT_NE(report.find("M msg/s"), std::string::npos);
+    EXPECT_NE(report.find("total"), std::string::npos);
+    EXPECT_NE(report.find(std::to_string(stats.messages())), std::string::npos);
+    EXPECT_GT(stats.wall_seconds, 0.0);
+}
@@ -8,9 +8,76 @@
 #include "parser.hpp"
 #include "simd_utils.hpp"
 #include "test_data.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
 
 using namespace simd_parser;
 
+// ============================================================================
+// Allocation Counting
+// ============================================================================
+
+// Replacing the global allocation functions lets tests assert that a code
+// path performs no heap allocations at all. Every new/delete form is
+// replaced, so nothing allocated by the runtime's versions reaches ours
+// (sanitizers report such mismatches).
+namespace {
+std::atomic<size_t> g_allocation_count{0};
+
+void* counted_alloc(size_t size, size_t alignment) noexcept {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    size = size == 0 ? 1 : size;
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size);
+    }
+    // aligned_alloc() wants a multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+void* counted_new(size_t size, size_t alignment) {
+    if (void* ptr = counted_alloc(size, alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+} // namespace
+
+void* operator new(size_t size) { return counted_new(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return counted_new(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t alignment) {
+    return counted_new(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return counted_new(size, static_cast<size_t>(alignment));
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return counted_alloc(size, alignof(std::max_align_t));
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return counted_alloc(size, alignof(std::max_align_t));
+}
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return counted_alloc(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return counted_alloc(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+
 // ============================================================================
 // Test Fixtures
 // ============================================================================
@@ -38,7 +105,7 @@ TEST_F(ParserTest, ParseScalar_ValidNewOrderSingle) {
     EXPECT_EQ(result.target, "TARGET");
     EXPECT_EQ(result.side, 1);
     EXPECT_EQ(result.quantity, 100);
-    EXPECT_DOUBLE_EQ(result.price, 150.25);
+    EXPECT_DOUBLE_EQ(result.price(), 150.25);
 }
 
 TEST_F(ParserTest, ParseSIMD_ValidNewOrderSingle) {
@@ -51,7 +118,7 @@ TEST_F(ParserTest, ParseSIMD_ValidNewOrderSingle) {
     EXPECT_EQ(result.target, "TARGET");
     EXPECT_EQ(result.side, 1);
     EXPECT_EQ(result.quantity, 100);
-    EXPECT_DOUBLE_EQ(result.price, 150.25);
+    EXPECT_DOUBLE_EQ(result.price(), 150.25);
 }
 
 TEST_F(ParserTest, ParseAuto_ValidNewOrderSingle) {
@@ -91,7 +158,335 @@ TEST_F(ParserTest, ScalarAndSIMD_ProduceSameResults) {
         EXPECT_EQ(scalar_result.target, simd_result.target) << "Message: " << msg;
         EXPECT_EQ(scalar_result.side, simd_result.side) << "Message: " << msg;
         EXPECT_EQ(scalar_result.quantity, simd_result.quantity) << "Message: " << msg;
-        EXPECT_DOUBLE_EQ(scalar_result.price, simd_result.price) << "Message: " << msg;
+        EXPECT_DOUBLE_EQ(scalar_result.price(), simd_result.price()) << "Message: " << msg;
+    }
+}
+
+TEST_F(ParserTest, ScalarAndSIMD_FieldsAcrossBlockBoundaries) {
+    // Grow the sender ID so the later fields slide across 64-byte boundaries
+    for (size_t pad = 0; pad < 130; ++pad) {
+        std::string msg = "8=FIX.4.4|35=D|49=" + std::string(pad, 'S') +
+                          "|56=TARGET|55=AAPL|54=2|38=700|44=99.5|";
+
+        auto scalar_result = parse_scalar(msg);
+        auto simd_result = parse_simd(msg);
+
+        EXPECT_TRUE(simd_result.valid) << "Pad: " << pad;
+        EXPECT_EQ(scalar_result.sender, simd_result.sender) << "Pad: " << pad;
+        EXPECT_EQ(scalar_result.target, simd_result.target) << "Pad: " << pad;
+        EXPECT_EQ(scalar_result.symbol, simd_result.symbol) << "Pad: " << pad;
+        EXPECT_EQ(scalar_result.side, simd_result.side) << "Pad: " << pad;
+        EXPECT_EQ(scalar_result.quantity, simd_result.quantity) << "Pad: " << pad;
+        EXPECT_DOUBLE_EQ(scalar_result.price(), simd_result.price()) << "Pad: " << pad;
+    }
+}
+
+TEST_F(ParserTest, ParseSIMDBatch_MatchesParseSIMD) {
+    std::vector<std::string> storage = test_data::generate_message_batch(37);
+    storage.push_back(test_data::valid::FULL_MESSAGE);
+    storage.push_back(test_data::valid::LOW_PRICE);
+    storage.push_back(test_data::with_header("35=D|55=AAPL|44=1e5|38=123456789012|54=A|"));
+    storage.push_back(test_data::with_header("35=D|52=20240115-14:30:00.123|55=MSFT|60=2024|"));
+    storage.push_back(test_data::invalid::NO_SYMBOL);
+    storage.push_back("");
+    // Truncated: only the declared BodyLength survives
+    storage.push_back("8=FIX.4.4|9=200|35=D|55=AAPL|44=1.5|");
+    std::vector<std::string_view> messages(storage.begin(), storage.end());
+
+    ParserContext context;
+    std::vector<FIXMessage> batch(messages.size());
+    parse_simd_batch(messages, context, batch);
+    EXPECT_EQ(batch.back().body_length, 200);
+
+    for (size_t i = 0; i < messages.size(); ++i) {
+        FIXMessage expected = parse_simd(messages[i], context);
+        EXPECT_EQ(batch[i].message_type, expected.message_type) << "Message " << i;
+        EXPECT_EQ(batch[i].symbol, expected.symbol) << "Message " << i;
+        EXPECT_EQ(batch[i].sender, expected.sender) << "Message " << i;
+        EXPECT_EQ(batch[i].target, expected.target) << "Message " << i;
+        EXPECT_EQ(batch[i].side, expected.side) << "Message " << i;
+        EXPECT_EQ(batch[i].price(), expected.price()) << "Message " << i;
+        EXPECT_EQ(batch[i].price_decimal, expected.price_decimal) << "Message " << i;
+        EXPECT_EQ(batch[i].quantity, expected.quantity) << "Message " << i;
+        EXPECT_EQ(batch[i].body_length, expected.body_length) << "Message " << i;
+        EXPECT_EQ(batch[i].sending_time, expected.sending_time) << "Message " << i;
+        EXPECT_EQ(batch[i].transact_time, expected.transact_time) << "Message " << i;
+        EXPECT_EQ(batch[i].valid, expected.valid) << "Message " << i;
+        EXPECT_EQ(batch[i].checksum_valid, expected.checksum_valid) << "Message " << i;
+    }
+}
+
+TEST_F(ParserTest, ParseSIMDBatch_SOH) {
+    std::string wire = test_data::to_soh(test_data::valid::EXECUTION_REPORT);
+    std::vector<std::string_view> messages(20, wire);
+    ParserContext context;
+    std::vector<FIXMessage> batch(messages.size());
+
+    parse_simd_batch<SOH>(messages, context, batch);
+
+    for (const FIXMessage& msg : batch) {
+        EXPECT_TRUE(msg.valid);
+        EXPECT_EQ(msg.symbol, "MSFT");
+        EXPECT_DOUBLE_EQ(msg.price(), 378.50);
+    }
+}
+
+// ============================================================================
+// Delimiter Specialization Tests
+// ============================================================================
+
+TEST_F(ParserTest, SOH_MatchesPipeResults) {
+    std::vector<std::string> test_messages = {
+        test_data::valid::NEW_ORDER_SINGLE,
+        test_data::valid::EXECUTION_REPORT,
+        test_data::valid::FULL_MESSAGE,
+        test_data::valid::LONG_IDS,
+        test_data::invalid::generate_long_message(5),
+    };
+
+    for (const auto& msg : test_messages) {
+        std::string soh_msg = test_data::to_soh(msg);
+        auto pipe_result = parse_simd(msg);
+
+        for (const auto& result : {parse_simd<SOH>(soh_msg), parse_scalar<SOH>(soh_msg),
+                                   parse_auto<SOH>(soh_msg)}) {
+            EXPECT_EQ(result.valid, pipe_result.valid) << "Message: " << msg;
+            EXPECT_EQ(result.message_type, pipe_result.message_type) << "Message: " << msg;
+            EXPECT_EQ(result.symbol, pipe_result.symbol) << "Message: " << msg;
+            EXPECT_EQ(result.sender, pipe_result.sender) << "Message: " << msg;
+            EXPECT_EQ(result.side, pipe_result.side) << "Message: " << msg;
+            EXPECT_EQ(result.quantity, pipe_result.quantity) << "Message: " << msg;
+            EXPECT_DOUBLE_EQ(result.price(), pipe_result.price()) << "Message: " << msg;
+        }
+    }
+}
+
+TEST_F(ParserTest, SOH_PipeIsOrdinaryValueByte) {
+    // With SOH delimiters, '|' is just part of a value
+    std::string msg = test_data::to_soh("35=D|55=AAPL|") + "58=a|b\x01";
+    auto result = parse_simd<SOH>(msg);
+
+    EXPECT_TRUE(result.valid);
+    EXPECT_EQ(result.symbol, "AAPL");
+
+    auto wrong_delimiter = parse_simd<SOH>(test_data::valid::NEW_ORDER_SINGLE);
+    EXPECT_FALSE(wrong_delimiter.valid);
+}
+
+TEST_F(ParserTest, DetectDelimiter) {
+    EXPECT_EQ(detect_delimiter(test_data::valid::NEW_ORDER_SINGLE), '|');
+    EXPECT_EQ(detect_delimiter(test_data::to_soh(test_data::valid::NEW_ORDER_SINGLE)), SOH);
+    EXPECT_EQ(detect_delimiter("8=FIX.4.4"), '\0');
+    EXPECT_EQ(detect_delimiter(""), '\0');
+}
+
+TEST_F(ParserTest, ParserForDelimiter_SniffOncePerStream) {
+    std::vector<std::string> stream = {
+        test_data::to_soh(test_data::valid::NEW_ORDER_SINGLE),
+        test_data::to_soh(test_data::valid::EXECUTION_REPORT),
+    };
+
+    ParseFunction parse = parser_for_delimiter(detect_delimiter(stream.front()));
+    ASSERT_NE(parse, nullptr);
+
+    EXPECT_EQ(parse(stream[0]).symbol, "AAPL");
+    EXPECT_EQ(parse(stream[1]).symbol, "MSFT");
+
+    EXPECT_EQ(parser_for_delimiter(','), nullptr);
+}
+
+// ============================================================================
+// CheckSum Tests
+// ============================================================================
+
+TEST_F(ParserTest, Checksum_ValidTrailer) {
+    for (const auto& msg : test_data::generate_message_batch(20)) {
+        std::string framed = test_data::with_checksum(msg);
+
+        EXPECT_TRUE(parse_scalar(framed).checksum_valid) << framed;
+        EXPECT_TRUE(parse_simd(framed).checksum_valid) << framed;
+    }
+}
+
+TEST_F(ParserTest, Checksum_CorruptedByteDetected) {
+    std::string msg = test_data::with_checksum(test_data::valid::NEW_ORDER_SINGLE);
+    msg[msg.find("AAPL")] = 'B';
+
+    EXPECT_FALSE(parse_scalar(msg).checksum_valid);
+    EXPECT_FALSE(parse_simd(msg).checksum_valid);
+    EXPECT_TRUE(parse_simd(msg).valid);
+}
+
+TEST_F(ParserTest, Checksum_MissingOrMalformed) {
+    const std::string& msg = test_data::valid::NEW_ORDER_SINGLE;
+    std::string not_digits = msg + "10=abc|";
+
+    EXPECT_FALSE(parse_scalar(msg).checksum_valid);
+    EXPECT_FALSE(parse_simd(msg).checksum_valid);
+    EXPECT_FALSE(parse_scalar(not_digits).checksum_valid);
+    EXPECT_FALSE(parse_simd(not_digits).checksum_valid);
+}
+
+TEST_F(ParserTest, Checksum_AcrossBlockBoundaries) {
+    for (size_t pad = 0; pad < 130; ++pad) {
+        std::string msg = test_data::with_checksum(
+            "8=FIX.4.4|35=D|49=" + std::string(pad, 'S') + "|55=AAPL|54=2|");
+
+        EXPECT_TRUE(parse_scalar(msg).checksum_valid) << "Pad: " << pad;
+        EXPECT_TRUE(parse_simd(msg).checksum_valid) << "Pad: " << pad;
+    }
+}
+
+TEST_F(ParserTest, Checksum_SOH) {
+    std::string msg = test_data::with_checksum(test_data::to_soh(test_data::valid::EXECUTION_REPORT), SOH);
+
+    EXPECT_TRUE(parse_scalar<SOH>(msg).checksum_valid);
+    EXPECT_TRUE(parse_simd<SOH>(msg).checksum_valid);
+}
+
+// ============================================================================
+// BodyLength Tests
+// ============================================================================
+
+TEST_F(ParserTest, BodyLength_Parsed) {
+    std::string msg = test_data::with_header("35=D|55=AAPL|54=1|");
+
+    auto scalar_result = parse_scalar(msg);
+    auto simd_result = parse_simd(msg);
+    EXPECT_EQ(scalar_result.body_length, 18);
+    EXPECT_EQ(simd_result.body_length, 18);
+    EXPECT_TRUE(simd_result.valid);
+    EXPECT_TRUE(simd_result.checksum_valid);
+    EXPECT_EQ(parse_simd(test_data::valid::FULL_MESSAGE).body_length, 63);
+}
+
+TEST_F(ParserTest, BodyLength_TruncatedMessageRejected) {
+    std::string msg = test_data::with_header("35=D|55=AAPL|54=1|38=100|44=150.25|");
+    const size_t body_end = msg.size() - 7;  // Everything before "10=xxx|"
+
+    for (size_t cut = body_end - 20; cut < body_end; ++cut) {
+        std::string_view truncated(msg.data(), cut);
+        auto scalar_result = parse_scalar(truncated);
+        auto simd_result = parse_simd(truncated);
+
+        EXPECT_FALSE(scalar_result.valid) << "Cut: " << cut;
+        EXPECT_FALSE(simd_result.valid) << "Cut: " << cut;
+        EXPECT_TRUE(simd_result.symbol.empty()) << "Cut: " << cut;
+        EXPECT_EQ(simd_result.body_length, 35) << "Cut: " << cut;
+    }
+
+    // Missing only the trailer is not truncation of the body
+    EXPECT_TRUE(parse_simd(std::string_view(msg.data(), body_end)).valid);
+}
+
+TEST_F(ParserTest, BodyLength_AbsentHeaderParsesAsBefore) {
+    // No tag 9, or tag 9 not in the header position: nothing to check against
+    EXPECT_TRUE(parse_simd(test_data::valid::MINIMAL).valid);
+    EXPECT_TRUE(parse_simd("35=D|9=500|55=AAPL|").valid);
+}
+
+// ============================================================================
+// Field Selection Tests
+// ============================================================================
+
+TEST_F(ParserTest, FieldMask_OnlyRequestedFieldsFilled) {
+    auto result = parse_simd(test_data::valid::NEW_ORDER_SINGLE,
+                             FieldMask{FIXTag::MessageType, FIXTag::Symbol});
+
+    EXPECT_TRUE(result.valid);
+    EXPECT_EQ(result.message_type, "D");
+    EXPECT_EQ(result.symbol, "AAPL");
+    EXPECT_TRUE(result.sender.empty());
+    EXPECT_EQ(result.side, 0);
+    EXPECT_DOUBLE_EQ(result.price(), 0.0);
+}
+
+TEST_F(ParserTest, FieldMask_MatchesFullParse) {
+    const FieldMask all{FIXTag::MessageType, FIXTag::Symbol, FIXTag::SenderCompID,
+                        FIXTag::TargetCompID, FIXTag::Side, FIXTag::Price, FIXTag::OrderQty};
+    for (const std::string& message : test_data::generate_message_batch(20)) {
+        auto full = parse_simd(message);
+        auto selected = parse_simd(message, all);
+
+        EXPECT_TRUE(selected.valid);
+        EXPECT_EQ(selected.message_type, full.message_type);
+        EXPECT_EQ(selected.symbol, full.symbol);
+        EXPECT_EQ(selected.sender, full.sender);
+        EXPECT_EQ(selected.target, full.target);
+        EXPECT_EQ(selected.side, full.side);
+        EXPECT_DOUBLE_EQ(selected.price(), full.price());
+        EXPECT_EQ(selected.quantity, full.quantity);
+    }
+}
+
+TEST_F(ParserTest, FieldMask_MissingFieldInvalid) {
+    auto result = parse_simd(test_data::valid::MINIMAL, FieldMask{FIXTag::Symbol, FIXTag::Price});
+
+    EXPECT_FALSE(result.valid);
+    EXPECT_EQ(result.symbol, "SPY");
+}
+
+TEST_F(ParserTest, FieldMask_FieldsAcrossWindows) {
+    // Requested fields far past the first window, and a field spanning
+    // several window boundaries
+    std::string padding(300, 'x');
+    std::string msg = "35=D|58=" + padding + "|49=A|56=B|" + "95=" + padding + padding +
+                      "|55=LATE|44=12.5|";
+    auto result = parse_simd(msg, FieldMask{FIXTag::Symbol, FIXTag::Price});
+
+    EXPECT_TRUE(result.valid);
+    EXPECT_EQ(result.symbol, "LATE");
+    EXPECT_DOUBLE_EQ(result.price(), 12.5);
+}
+
+TEST_F(ParserTest, FieldMask_LastFieldWithoutDelimiter) {
+    auto result = parse_simd("35=D|55=AAPL|44=99.5", FieldMask{FIXTag::Price});
+
+    EXPECT_TRUE(result.valid);
+    EXPECT_DOUBLE_EQ(result.price(), 99.5);
+}
+
+TEST_F(ParserTest, FieldMask_Checksum) {
+    std::string msg = test_data::with_header(
+        "35=D|49=A|56=B|55=AAPL|54=1|38=100|44=1.5|58=" + std::string(200, 'y') + "|");
+    auto result = parse_simd(msg, FieldMask{FIXTag::MessageType, FIXTag::CheckSum});
+
+    EXPECT_TRUE(result.valid);
+    EXPECT_TRUE(result.checksum_valid);
+}
+
+TEST_F(ParserTest, FieldMask_EmptyMaskInvalid) {
+    EXPECT_FALSE(parse_simd(test_data::valid::NEW_ORDER_SINGLE, FieldMask{}).valid);
+}
+
+TEST_F(ParserTest, FieldMask_SOH) {
+    std::string wire = test_data::to_soh(test_data::valid::EXECUTION_REPORT);
+    auto result = parse_simd<SOH>(wire, FieldMask{FIXTag::Symbol, FIXTag::OrderQty});
+
+    EXPECT_TRUE(result.valid);
+    EXPECT_EQ(result.symbol, "MSFT");
+    EXPECT_EQ(result.quantity, 500);
+}
+
+// ============================================================================
+// Tag Dispatch Tests
+// ============================================================================
+
+TEST_F(ParserTest, TagDispatch_NonNumericTagIgnored) {
+    // A tag must be all digits; "35x" is not tag 35
+    for (ParseFunction parse : {ParseFunction(parse_scalar<'|'>), ParseFunction(parse_simd<'|'>)}) {
+        auto result = parse("35x=D|55=AAPL|");
+        EXPECT_TRUE(result.message_type.empty());
+        EXPECT_EQ(result.symbol, "AAPL");
+        EXPECT_FALSE(result.valid);
+    }
+}
+
+TEST_F(ParserTest, TagDispatch_TagsOutsideTableIgnored) {
+    for (ParseFunction parse : {ParseFunction(parse_scalar<'|'>), ParseFunction(parse_simd<'|'>)}) {
+        auto result = parse("35=D|5000=X|1055=Y|55=AAPL|");
+        EXPECT_TRUE(result.valid);
+        EXPECT_EQ(result.symbol, "AAPL");
     }
 }
 
@@ -149,14 +544,64 @@ TEST_F(ParserTest, Parse_HighPrice) {
     auto result = parse_auto(test_data::valid::HIGH_PRICE);
 
     EXPECT_TRUE(result.valid);
-    EXPECT_DOUBLE_EQ(result.price, 628450.00);
+    EXPECT_DOUBLE_EQ(result.price(), 628450.00);
 }
 
 TEST_F(ParserTest, Parse_LowPrice) {
     auto result = parse_auto(test_data::valid::LOW_PRICE);
 
     EXPECT_TRUE(result.valid);
-    EXPECT_NEAR(result.price, 0.0025, 0.0001);
+    EXPECT_NEAR(result.price(), 0.0025, 0.0001);
+}
+
+TEST_F(ParserTest, Parse_ExactDecimalPrice) {
+    auto scalar = parse_scalar(test_data::valid::LOW_PRICE);
+    auto simd = parse_simd(test_data::valid::LOW_PRICE);
+
+    EXPECT_EQ(scalar.price_decimal, (Decimal64{25, -4}));
+    EXPECT_EQ(simd.price_decimal, (Decimal64{25, -4}));
+    EXPECT_EQ(simd.price_decimal.rescale(-4), 25);
+}
+
+TEST_F(ParserTest, Parse_PriceDoubleOnDemand) {
+    // A plain decimal is only stored as Decimal64; price() converts it
+    ParserContext context;
+    std::vector<FIXMessage> batch(1);
+    parse_simd_batch(std::vector<std::string_view>{test_data::valid::NEW_ORDER_SINGLE}, context, batch);
+    for (const FIXMessage& msg : {parse_scalar(test_data::valid::NEW_ORDER_SINGLE),
+                                  parse_simd(test_data::valid::NEW_ORDER_SINGLE), batch[0],
+                                  parse_lazy(test_data::valid::NEW_ORDER_SINGLE).to_message()}) {
+        EXPECT_EQ(msg.price_fallback, 0.0);
+        EXPECT_DOUBLE_EQ(msg.price(), 150.25);
+    }
+
+    // Exponent notation has no Decimal64 form, so the double is kept
+    const std::string message = test_data::with_header("35=D|55=AAPL|54=1|38=100|44=1.5e2|");
+    parse_simd_batch(std::vector<std::string_view>{message}, context, batch);
+    for (const FIXMessage& msg : {parse_scalar(message), parse_simd(message), batch[0],
+                                  parse_lazy(message).to_message()}) {
+        EXPECT_EQ(msg.price_decimal, Decimal64{});
+        EXPECT_DOUBLE_EQ(msg.price_fallback, 150.0);
+        EXPECT_DOUBLE_EQ(msg.price(), 150.0);
+    }
+}
+
+TEST_F(ParserTest, Parse_Timestamps) {
+    std::string message = test_data::with_header(
+        "35=D|49=A|56=B|52=20240115-14:30:00.250|55=AAPL|54=1|38=100|44=1.5|"
+        "60=20240115-14:29:59.999999|");
+    const int64_t base = 1705329000000000000;
+
+    for (const FIXMessage& result : {parse_scalar(message), parse_simd(message)}) {
+        EXPECT_TRUE(result.valid);
+        EXPECT_EQ(result.sending_time, base + 250000000);
+        EXPECT_EQ(result.transact_time, base - 1000);
+    }
+
+    // Absent timestamps read as zero
+    auto simd = parse_simd(test_data::valid::NEW_ORDER_SINGLE);
+    EXPECT_EQ(simd.sending_time, 0);
+    EXPECT_EQ(simd.transact_time, 0);
 }
 
 // ============================================================================
@@ -253,6 +698,83 @@ TEST_F(ParserTest, Parse_BatchMessages) {
     }
 }
 
+// ============================================================================
+// Parser Context Tests
+// ============================================================================
+
+TEST_F(ParserTest, Context_MatchesDefaultParse) {
+    ParserContext context;
+
+    auto with_context = parse_simd(test_data::valid::FULL_MESSAGE, context);
+    auto without_context = parse_simd(test_data::valid::FULL_MESSAGE);
+
+    EXPECT_TRUE(with_context.valid);
+    EXPECT_EQ(with_context.symbol, without_context.symbol);
+    EXPECT_EQ(with_context.sender, without_context.sender);
+    EXPECT_EQ(with_context.quantity, without_context.quantity);
+    EXPECT_DOUBLE_EQ(with_context.price(), without_context.price());
+
+    auto scalar_result = parse_scalar(test_data::valid::FULL_MESSAGE, context);
+    EXPECT_EQ(scalar_result.symbol, with_context.symbol);
+}
+
+TEST_F(ParserTest, Context_SteadyStateDoesNotAllocate) {
+    auto messages = test_data::generate_message_batch(100);
+    ParserContext context;
+
+    size_t before = g_allocation_count.load();
+    for (const auto& msg : messages) {
+        auto simd_result = parse_simd(msg, context);
+        auto scalar_result = parse_scalar(msg, context);
+        EXPECT_TRUE(simd_result.valid);
+        EXPECT_TRUE(scalar_result.valid);
+    }
+
+    EXPECT_EQ(g_allocation_count.load(), before);
+}
+
+TEST_F(ParserTest, Context_OnlyDelimitersDoesNotAllocate) {
+    // Every byte is a delimiter position, the most parse_scalar() can record
+    const std::string delimiters(256, '|');
+    ParserContext context(delimiters.size());
+
+    size_t before = g_allocation_count.load();
+    parse_scalar(delimiters, context);
+    parse_simd(delimiters, context);
+
+    EXPECT_EQ(g_allocation_count.load(), before);
+}
+
+TEST_F(ParserTest, Context_GrowsOnceForOversizedMessage) {
+    std::string long_msg = test_data::invalid::generate_long_message(200);
+    ParserContext context(64);
+
+    // First parse may grow the buffers; the second must reuse them
+    parse_simd(long_msg, context);
+    parse_scalar(long_msg, context);
+
+    size_t before = g_allocation_count.load();
+    parse_simd(long_msg, context);
+    parse_scalar(long_msg, context);
+
+    EXPECT_EQ(g_allocation_count.load(), before);
+}
+
+TEST_F(ParserTest, ThreadContext_DefaultParseDoesNotAllocate) {
+    auto messages = test_data::generate_message_batch(100);
+
+    // Warm up the thread-local context
+    parse_auto(messages.front());
+
+    size_t before = g_allocation_count.load();
+    for (const auto& msg : messages) {
+        auto result = parse_auto(msg);
+        EXPECT_TRUE(result.valid);
+    }
+
+    EXPECT_EQ(g_allocation_count.load(), before);
+}
+
 // ============================================================================
 // String View Lifetime Tests
 // ============================================================================
@@ -0,0 +1,505 @@
+/**
+ * Pipeline Unit Tests
+ *
+ * Tests for the lock-free rings and for ParsePipeline: every framed message
+ * must reach the consumer exactly once, parsed as parse_auto() would.
+ */
+
+#include <gtest/gtest.h>
+#include "pipeline.hpp"
+#include "parser.hpp"
+#include "ring_buffer.hpp"
+#include "shard_router.hpp"
+#include "test_data.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Test Fixtures
+// ============================================================================
+
+// Hands out a string in pieces of at most chunk bytes
+ParsePipeline::Source string_source(const std::string& data, size_t chunk) {
+    return [&data, chunk, offset = size_t(0)](std::span<char> buffer) mutable {
+        const size_t count = std::min({chunk, buffer.size(), data.size() - offset});
+        std::memcpy(buffer.data(), data.data() + offset, count);
+        offset += count;
+        return count;
+    };
+}
+
+// What the consumer saw, with message bytes copied out of the block
+struct Received {
+    uint64_t sequence;
+    uint32_t parser;
+    std::string raw_symbol;
+    std::string message_type;
+    int32_t side;
+    double price;
+    int32_t quantity;
+    int64_t sending_time;
+    bool valid;
+    bool checksum_valid;
+};
+
+template <char Delimiter = '|'>
+std::vector<Received> run_pipeline(const PipelineOptions& options, const std::string& stream,
+                                   size_t chunk, PipelineStats* stats = nullptr) {
+    ParsePipeline pipeline(options);
+    std::vector<Received> received;
+    PipelineStats result = pipeline.run<Delimiter>(string_source(stream, chunk),
+                                                   [&](std::span<const ParsedRecord> records) {
+        for (const ParsedRecord& record : records) {
+            const FIXMessage& msg = record.message;
+            received.push_back({record.sequence, record.parser, std::string(msg.symbol),
+                                std::string(msg.message_type), msg.side, msg.price(), msg.quantity,
+                                msg.sending_time, msg.valid, msg.checksum_valid});
+        }
+    });
+    if (stats != nullptr) {
+        *stats = result;
+    }
+    return received;
+}
+
+template <char Delimiter = '|'>
+void expect_matches_parse_auto(std::vector<Received> received, const std::string& stream) {
+    const std::vector<std::string_view> expected = test_data::frame_stream<Delimiter>(stream);
+    std::sort(received.begin(), received.end(),
+              [](const Received& a, const Received& b) { return a.sequence < b.sequence; });
+
+    ASSERT_EQ(received.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const FIXMessage msg = parse_auto<Delimiter>(expected[i]);
+        EXPECT_EQ(received[i].sequence, i);
+        EXPECT_EQ(received[i].raw_symbol, msg.symbol) << "Message " << i;
+        EXPECT_EQ(received[i].message_type, msg.message_type) << "Message " << i;
+        EXPECT_EQ(received[i].side, msg.side) << "Message " << i;
+        EXPECT_EQ(received[i].price, msg.price()) << "Message " << i;
+        EXPECT_EQ(received[i].quantity, msg.quantity) << "Message " << i;
+        EXPECT_EQ(received[i].sending_time, msg.sending_time) << "Message " << i;
+        EXPECT_EQ(received[i].valid, msg.valid) << "Message " << i;
+        EXPECT_EQ(received[i].checksum_valid, msg.checksum_valid) << "Message " << i;
+    }
+}
+
+// ============================================================================
+// SPSC Ring Tests
+// ============================================================================
+
+TEST(SpscRingTest, CapacityRoundsUp) {
+    EXPECT_EQ(SpscRing<int>(5).capacity(), 8u);
+    EXPECT_EQ(SpscRing<int>(8).capacity(), 8u);
+    EXPECT_EQ(SpscRing<int>(0).capacity(), 2u);
+}
+
+TEST(SpscRingTest, BatchPushStopsWhenFull) {
+    SpscRing<int> ring(8);
+    std::vector<int> items = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    EXPECT_EQ(ring.try_push(std::span<const int>(items)), 8u);
+    EXPECT_EQ(ring.try_push(9), false);
+    EXPECT_EQ(ring.size(), 8u);
+
+    std::vector<int> out(3);
+    ASSERT_EQ(ring.try_pop(std::span(out)), 3u);
+    EXPECT_EQ(out, (std::vector<int>{0, 1, 2}));
+
+    // Wraps around the end of the slot array
+    EXPECT_EQ(ring.try_push(std::span<const int>(items).subspan(8)), 2u);
+    out.resize(16);
+    ASSERT_EQ(ring.try_pop(std::span(out)), 7u);
+    EXPECT_EQ(out[0], 3);
+    EXPECT_EQ(out[6], 9);
+    EXPECT_FALSE(ring.try_pop(out[0]));
+}
+
+TEST(SpscRingTest, TwoThreadsKeepOrder) {
+    SpscRing<uint64_t> ring(64);
+    constexpr uint64_t COUNT = 200000;
+
+    std::thread producer([&] {
+        std::array<uint64_t, 7> batch;
+        Backoff backoff;
+        for (uint64_t next = 0; next < COUNT;) {
+            const size_t count = std::min<uint64_t>(batch.size(), COUNT - next);
+            for (size_t i = 0; i < count; ++i) {
+                batch[i] = next + i;
+            }
+            const size_t pushed = ring.try_push(std::span<const uint64_t>(batch.data(), count));
+            if (pushed == 0) {
+                backoff.wait();
+            }
+            next += pushed;
+        }
+    });
+
+    std::array<uint64_t, 5> out;
+    Backoff backoff;
+    uint64_t expected = 0;
+    bool ordered = true;
+    while (expected < COUNT) {
+        const size_t count = ring.try_pop(std::span(out));
+        if (count == 0) {
+            backoff.wait();
+        }
+        for (size_t i = 0; i < count; ++i) {
+            ordered &= out[i] == expected++;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(ring.size(), 0u);
+}
+
+// ============================================================================
+// MPSC Ring Tests
+// ============================================================================
+
+TEST(MpscRingTest, BatchPushStopsWhenFull) {
+    MpscRing<int> ring(4);
+    std::vector<int> items = {1, 2, 3, 4, 5, 6};
+
+    EXPECT_EQ(ring.try_push(std::span<const int>(items)), 4u);
+    EXPECT_FALSE(ring.try_push(7));
+
+    std::vector<int> out(2);
+    ASSERT_EQ(ring.try_pop(std::span(out)), 2u);
+    EXPECT_EQ(out, (std::vector<int>{1, 2}));
+    EXPECT_EQ(ring.try_push(std::span<const int>(items).subspan(4)), 2u);
+
+    out.resize(8);
+    ASSERT_EQ(ring.try_pop(std::span(out)), 4u);
+    EXPECT_EQ(out[0], 3);
+    EXPECT_EQ(out[3], 6);
+}
+
+TEST(MpscRingTest, ProducersKeepTheirOwnOrder) {
+    MpscRing<std::pair<uint32_t, uint32_t>> ring(32);
+    constexpr uint32_t PRODUCERS = 4;
+    constexpr uint32_t PER_PRODUCER = 50000;
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&ring, p] {
+            std::array<std::pair<uint32_t, uint32_t>, 3> batch;
+            Backoff backoff;
+            for (uint32_t next = 0; next < PER_PRODUCER;) {
+                const size_t count = std::min<uint32_t>(batch.size(), PER_PRODUCER - next);
+                for (size_t i = 0; i < count; ++i) {
+                    batch[i] = {p, next + static_cast<uint32_t>(i)};
+                }
+                const size_t pushed = ring.try_push(std::span<const std::pair<uint32_t, uint32_t>>(batch.data(), count));
+                if (pushed == 0) {
+                    backoff.wait();
+                }
+                next += static_cast<uint32_t>(pushed);
+            }
+        });
+    }
+
+    std::vector<uint32_t> next(PRODUCERS, 0);
+    std::array<std::pair<uint32_t, uint32_t>, 8> out;
+    Backoff backoff;
+    bool ordered = true;
+    for (size_t received = 0; received < PRODUCERS * PER_PRODUCER;) {
+        const size_t count = ring.try_pop(std::span(out));
+        if (count == 0) {
+            backoff.wait();
+        }
+        for (size_t i = 0; i < count; ++i) {
+            ordered &= out[i].second == next[out[i].first]++;
+        }
+        received += count;
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    for (uint32_t p = 0; p < PRODUCERS; ++p) {
+        EXPECT_EQ(next[p], PER_PRODUCER);
+    }
+    EXPECT_FALSE(ring.try_pop(out[0]));
+}
+
+// ============================================================================
+// Pipeline Tests
+// ============================================================================
+
+TEST(PipelineTest, EveryMessageParsedOnce) {
+    const std::string stream = test_data::generate_message_stream(5000);
+    PipelineOptions options;
+    options.parser_threads = 3;
+    PipelineStats stats;
+
+    std::vector<Received> received = run_pipeline(options, stream, 4096, &stats);
+
+    expect_matches_parse_auto(received, stream);
+    EXPECT_EQ(stats.messages, 5000u);
+    EXPECT_EQ(stats.bytes, stream.size());
+    EXPECT_GT(stats.blocks, 0u);
+    EXPECT_GT(stats.consumer_batches, 0u);
+}
+
+TEST(PipelineTest, SingleParserKeepsStreamOrder) {
+    const std::string stream = test_data::generate_message_stream(1000);
+    PipelineOptions options;
+    options.parser_threads = 1;
+
+    std::vector<Received> received = run_pipeline(options, stream, 1000);
+
+    ASSERT_EQ(received.size(), 1000u);
+    for (size_t i = 0; i < received.size(); ++i) {
+        EXPECT_EQ(received[i].sequence, i);
+        EXPECT_EQ(received[i].parser, 0u);
+    }
+}
+
+TEST(PipelineTest, SmallBlocksAreRecycled) {
+    // Two 256-byte blocks: messages straddle every block boundary and each
+    // block must come back from the consumer before ingest can continue
+    const std::string stream = test_data::generate_message_stream(2000);
+    PipelineOptions options;
+    options.parser_threads = 2;
+    options.ring_capacity = 4;
+    options.batch_size = 3;
+    options.block_bytes = 256;
+    options.block_count = 2;
+    PipelineStats stats;
+
+    std::vector<Received> received = run_pipeline(options, stream, 97, &stats);
+
+    expect_matches_parse_auto(received, stream);
+    EXPECT_GT(stats.blocks, stream.size() / 256);
+}
+
+TEST(PipelineTest, ByteAtATimeSource) {
+    const std::string stream = test_data::generate_message_stream(50);
+    PipelineOptions options;
+    options.block_bytes = 1024;
+
+    expect_matches_parse_auto(run_pipeline(options, stream, 1), stream);
+}
+
+TEST(PipelineTest, OversizedMessageTruncated) {
+    std::string huge = test_data::with_header("35=D|49=A|56=B|55=AAPL|58=" + std::string(600, 'x') + "|");
+    const std::string stream = test_data::generate_message_stream(3) + huge + test_data::generate_message_stream(3);
+    PipelineOptions options;
+    options.block_bytes = 256;
+
+    std::vector<Received> received = run_pipeline(options, stream, 4096);
+
+    // The long message arrives cut at the block size (so it fails to
+    // parse) and framing resynchronises on the messages after it
+    ASSERT_EQ(received.size(), 7u);
+    std::sort(received.begin(), received.end(),
+              [](const Received& a, const Received& b) { return a.sequence < b.sequence; });
+    EXPECT_EQ(received[2].raw_symbol, "ESZ4 Comdty");
+    EXPECT_FALSE(received[3].valid);
+    EXPECT_EQ(received[4].raw_symbol, "AAPL");
+    EXPECT_TRUE(received[4].checksum_valid);
+    EXPECT_EQ(received[6].raw_symbol, "ESZ4 Comdty");
+}
+
+TEST(PipelineTest, SOH) {
+    const std::string stream = test_data::generate_message_stream(3000, SOH);
+    PipelineOptions options;
+    options.parser_threads = 2;
+
+    expect_matches_parse_auto<SOH>(run_pipeline<SOH>(options, stream, 8192), stream);
+}
+
+TEST(PipelineTest, EmptySource) {
+    ParsePipeline pipeline;
+    size_t calls = 0;
+
+    PipelineStats stats = pipeline.run([](std::span<char>) { return size_t(0); },
+                                       [&](std::span<const ParsedRecord>) { ++calls; });
+
+    EXPECT_EQ(calls, 0u);
+    EXPECT_EQ(stats.messages, 0u);
+    EXPECT_EQ(stats.bytes, 0u);
+}
+
+TEST(PipelineTest, ReusableAcrossRuns) {
+    ParsePipeline pipeline(PipelineOptions{2, 64, 8, 512, 4});
+    const std::string first = test_data::generate_message_stream(400);
+    const std::string second = test_data::generate_message_stream(7);
+    size_t received = 0;
+    auto count = [&](std::span<const ParsedRecord> records) { received += records.size(); };
+
+    pipeline.run(string_source(first, 300), count);
+    EXPECT_EQ(received, 400u);
+    received = 0;
+    pipeline.run(string_source(second, 300), count);
+    EXPECT_EQ(received, 7u);
+}
+
+// ============================================================================
+// Shard Routing Tests
+// ============================================================================
+
+TEST(ShardRouterTest, ScanSymbol) {
+    for (SimdLevel level : test_data::supported_levels()) {
+        SCOPED_TRACE(simd_level_name(level));
+        EXPECT_EQ(scan_symbol(test_data::valid::NEW_ORDER_SINGLE, level), "AAPL");
+        EXPECT_EQ(scan_symbol(test_data::valid::LONG_SYMBOL, level),
+                  parse_scalar(test_data::valid::LONG_SYMBOL).symbol);
+        EXPECT_EQ(scan_symbol("55=IBM|54=1|", level), "IBM");
+        EXPECT_EQ(scan_symbol("8=FIX.4.4|35=D|55=MSFT", level), "MSFT");
+        EXPECT_EQ(scan_symbol("8=FIX.4.4|35=D|55=|54=1|", level), "");
+        EXPECT_EQ(scan_symbol(test_data::invalid::NO_SYMBOL, level), "");
+        EXPECT_EQ(scan_symbol("", level), "");
+        // Tags ending in 55 are not Symbol
+        EXPECT_EQ(scan_symbol("8=FIX.4.4|155=X|455=Y|55=Z|", level), "Z");
+        EXPECT_EQ(scan_symbol<SOH>(test_data::to_soh("8=FIX.4.4|35=D|55=ESZ4|"), level), "ESZ4");
+    }
+}
+
+TEST(ShardRouterTest, ScanSymbolAtEveryOffset) {
+    // Moves the tag across vector boundaries and up to the end of the input
+    for (size_t padding = 0; padding < 150; ++padding) {
+        const std::string message = "8=FIX.4.4|58=" + std::string(padding, 'x') + "|55=SYM|";
+        for (SimdLevel level : test_data::supported_levels()) {
+            EXPECT_EQ(scan_symbol(message, level), "SYM") << simd_level_name(level) << ", padding " << padding;
+            EXPECT_EQ(scan_symbol(std::string_view(message).substr(0, message.size() - 4), level), "")
+                << simd_level_name(level) << ", padding " << padding;
+        }
+    }
+}
+
+TEST(ShardRouterTest, SymbolShardIsStableAndSpread) {
+    constexpr size_t SHARDS = 4;
+    std::vector<size_t> counts(SHARDS);
+    for (size_t i = 0; i < 2000; ++i) {
+        std::string symbol = "SYM";
+        symbol.append(std::to_string(i));
+        const uint32_t shard = symbol_shard(symbol, SHARDS);
+        ASSERT_LT(shard, SHARDS);
+        EXPECT_EQ(symbol_shard(std::string(symbol), SHARDS), shard);
+        ++counts[shard];
+    }
+    for (size_t count : counts) {
+        EXPECT_GT(count, 2000 / SHARDS / 2);
+    }
+    EXPECT_EQ(symbol_shard("", SHARDS), 0u);
+    EXPECT_EQ(symbol_shard("AAPL", 1), 0u);
+    EXPECT_EQ(symbol_shard("A LONG INSTRUMENT NAME", 1), 0u);
+}
+
+// ============================================================================
+// Sharded Pipeline Tests
+// ============================================================================
+
+// Per-shard log of what the consumer saw, written only by that shard
+struct ShardLog {
+    std::vector<Received> records;
+    std::map<std::string, uint32_t> symbol_ids;
+    bool ids_consistent = true;
+};
+
+template <char Delimiter = '|'>
+std::vector<ShardLog> run_sharded(const PipelineOptions& options, const std::string& stream, size_t chunk) {
+    ParsePipeline pipeline(options);
+    std::vector<ShardLog> logs(options.parser_threads);
+    pipeline.run_sharded<Delimiter>(string_source(stream, chunk),
+                                    [&](uint32_t shard, std::span<const ParsedRecord> records) {
+        ShardLog& log = logs[shard];
+        for (const ParsedRecord& record : records) {
+            const FIXMessage& msg = record.message;
+            log.records.push_back({record.sequence, record.parser, std::string(msg.symbol),
+                                   std::string(msg.message_type), msg.side, msg.price(), msg.quantity,
+                                   msg.sending_time, msg.valid, msg.checksum_valid});
+            if (!msg.symbol.empty()) {
+                auto [it, inserted] = log.symbol_ids.emplace(std::string(msg.symbol), msg.symbol_id);
+                log.ids_consistent &= it->second == msg.symbol_id;
+            }
+        }
+    });
+    return logs;
+}
+
+TEST(PipelineTest, ShardedKeepsPerSymbolOrder) {
+    // Many instruments so every shard gets several
+    std::string stream;
+    for (size_t i = 0; i < 4000; ++i) {
+        std::string body = "35=D|49=A|56=B|55=SYM";
+        body.append(std::to_string(i % 37));
+        body.append("|54=1|38=");
+        body.append(std::to_string(i));
+        body.append("|44=1.5|");
+        stream += test_data::with_header(body);
+    }
+    PipelineOptions options;
+    options.parser_threads = 3;
+    options.block_bytes = 4096;
+    options.block_count = 4;
+
+    std::vector<ShardLog> logs = run_sharded(options, stream, 1500);
+
+    std::map<std::string, uint32_t> owner;
+    std::vector<Received> all;
+    for (uint32_t shard = 0; shard < logs.size(); ++shard) {
+        const ShardLog& log = logs[shard];
+        EXPECT_TRUE(log.ids_consistent);
+        EXPECT_FALSE(log.records.empty());
+        for (size_t i = 0; i < log.records.size(); ++i) {
+            const Received& record = log.records[i];
+            EXPECT_EQ(record.parser, shard);
+            EXPECT_EQ(symbol_shard(record.raw_symbol, logs.size()), shard);
+            auto [it, inserted] = owner.emplace(record.raw_symbol, shard);
+            EXPECT_EQ(it->second, shard) << record.raw_symbol << " seen on two shards";
+            if (i > 0) {
+                EXPECT_LT(log.records[i - 1].sequence, record.sequence);
+            }
+        }
+        all.insert(all.end(), log.records.begin(), log.records.end());
+    }
+    EXPECT_EQ(owner.size(), 37u);
+    expect_matches_parse_auto(all, stream);
+}
+
+TEST(PipelineTest, ShardedMessagesWithoutSymbolGoToShardZero) {
+    const std::string stream = test_data::generate_message_stream(500);
+    PipelineOptions options;
+    options.parser_threads = 4;
+
+    std::vector<ShardLog> logs = run_sharded(options, stream, 4096);
+
+    size_t total = 0;
+    size_t no_symbol = 0;
+    for (const ShardLog& log : logs) {
+        total += log.records.size();
+    }
+    for (const Received& record : logs[0].records) {
+        no_symbol += record.raw_symbol.empty();
+    }
+    EXPECT_EQ(total, 500u);
+    EXPECT_EQ(no_symbol, 100u);
+}
+
+TEST(PipelineTest, ShardedSOH) {
+    const std::string stream = test_data::generate_message_stream(1500, SOH);
+    PipelineOptions options;
+    options.parser_threads = 2;
+    options.block_bytes = 1024;
+    options.block_count = 2;
+
+    std::vector<ShardLog> logs = run_sharded<SOH>(options, stream, 700);
+
+    std::vector<Received> all;
+    for (const ShardLog& log : logs) {
+        all.insert(all.end(), log.records.begin(), log.records.end());
+    }
+    expect_matches_parse_auto<SOH>(all, stream);
+}
@@ -0,0 +1,770 @@
+/**
+ * SIMD Utilities Unit Tests
+ *
+ * Tests for CPU detection, delimiter finding tiers and numeric parsing.
+ */
+
+#include <gtest/gtest.h>
+#include "simd_utils.hpp"
+#include "test_data.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Test Fixtures
+// ============================================================================
+
+using DelimiterFinder = std::vector<size_t> (*)(std::string_view, char);
+
+struct FinderTier {
+    const char* name;
+    DelimiterFinder finder;
+};
+
+// Every delimiter finder the current CPU can execute
+std::vector<FinderTier> supported_finders() {
+    const CpuFeatures& features = cpu_features();
+
+    std::vector<FinderTier> tiers = {
+        {"scalar", find_delimiters_scalar},
+        {"simd", find_delimiters_simd},
+    };
+    if (features.sse42) {
+        tiers.push_back({"sse42", find_delimiters_sse42});
+    }
+    if (features.avx2) {
+        tiers.push_back({"avx2", find_delimiters_avx2});
+    }
+    if (has_avx512_support()) {
+        tiers.push_back({"avx512", find_delimiters_avx512});
+    }
+    if (cpu_features().best_level() >= SimdLevel::AVX512VBMI2) {
+        tiers.push_back({"avx512_vbmi2", find_delimiters_avx512_vbmi2});
+    }
+    return tiers;
+}
+
+using FieldList = std::vector<std::pair<std::string, std::string>>;
+
+FieldList collect_fields(std::string_view data, char delimiter = '|') {
+    StructuralIndex index;
+    build_structural_index(data, delimiter, index);
+
+    FieldList fields;
+    for_each_field(data, index, [&fields](std::string_view tag, std::string_view value) {
+        fields.emplace_back(tag, value);
+    });
+    return fields;
+}
+
+// ============================================================================
+// CPU Detection Tests
+// ============================================================================
+
+TEST(CpuFeaturesTest, DetectionIsCached) {
+    EXPECT_EQ(&cpu_features(), &cpu_features());
+}
+
+TEST(CpuFeaturesTest, AVX512MatchesLegacyCheck) {
+    const CpuFeatures& features = cpu_features();
+
+    EXPECT_EQ(has_avx512_support(), features.avx512f && features.avx512bw);
+}
+
+TEST(CpuFeaturesTest, BestLevelIsWidestAvailable) {
+    CpuFeatures features;
+    EXPECT_EQ(features.best_level(), SimdLevel::Scalar);
+
+    features.sse42 = true;
+    EXPECT_EQ(features.best_level(), SimdLevel::SSE42);
+
+    features.avx2 = true;
+    EXPECT_EQ(features.best_level(), SimdLevel::AVX2);
+
+    // AVX512F alone is not enough: byte compares need AVX512BW
+    features.avx512f = true;
+    EXPECT_EQ(features.best_level(), SimdLevel::AVX2);
+
+    features.avx512bw = true;
+    EXPECT_EQ(features.best_level(), SimdLevel::AVX512);
+
+    features.avx512vbmi2 = true;
+    EXPECT_EQ(features.best_level(), SimdLevel::AVX512VBMI2);
+
+    // VBMI2 without the AVX-512 base is not usable
+    features.avx512bw = false;
+    EXPECT_EQ(features.best_level(), SimdLevel::AVX2);
+}
+
+TEST(CpuFeaturesTest, LevelNames) {
+    EXPECT_STREQ(simd_level_name(SimdLevel::Scalar), "Scalar");
+    EXPECT_STREQ(simd_level_name(SimdLevel::SSE42), "SSE4.2");
+    EXPECT_STREQ(simd_level_name(SimdLevel::AVX2), "AVX2");
+    EXPECT_STREQ(simd_level_name(SimdLevel::AVX512), "AVX-512");
+    EXPECT_STREQ(simd_level_name(SimdLevel::AVX512VBMI2), "AVX-512 VBMI2");
+}
+
+// ============================================================================
+// Delimiter Finding Tests
+// ============================================================================
+
+TEST(FindDelimitersTest, AllTiers_TableCases) {
+    for (const auto& tier : supported_finders()) {
+        for (const auto& tc : test_data::delimiters::CASES) {
+            EXPECT_EQ(tier.finder(tc.input, tc.delimiter), tc.expected)
+                << "Tier: " << tier.name << " Input: " << tc.input;
+        }
+    }
+}
+
+TEST(FindDelimitersTest, AllTiers_MatchScalarAcrossSizes) {
+    // Sizes straddle the 16/32/64-byte vector widths to exercise the tails
+    for (size_t length : {1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 200, 1000}) {
+        std::string data = test_data::delimiters::generate_test_string(length, length / 7);
+        auto expected = find_delimiters_scalar(data, '|');
+
+        for (const auto& tier : supported_finders()) {
+            EXPECT_EQ(tier.finder(data, '|'), expected)
+                << "Tier: " << tier.name << " Length: " << length;
+        }
+    }
+}
+
+TEST(FindDelimitersTest, AllTiers_DelimiterAtVectorBoundaries) {
+    std::string data(128, 'X');
+    for (size_t pos : {0, 15, 16, 31, 32, 63, 64, 127}) {
+        data[pos] = '|';
+    }
+    std::vector<size_t> expected = {0, 15, 16, 31, 32, 63, 64, 127};
+
+    for (const auto& tier : supported_finders()) {
+        EXPECT_EQ(tier.finder(data, '|'), expected) << "Tier: " << tier.name;
+    }
+}
+
+TEST(FindDelimitersTest, AllTiers_HighBitDelimiter) {
+    // Bytes >= 0x80 are negative as char; compares must still be exact
+    std::string data = "a\xff" "b\xfe" "c\xff";
+
+    for (const auto& tier : supported_finders()) {
+        EXPECT_EQ(tier.finder(data, '\xff'), (std::vector<size_t>{1, 5}))
+            << "Tier: " << tier.name;
+    }
+}
+
+// ============================================================================
+// Span-Based Delimiter Finding Tests
+// ============================================================================
+
+TEST(FindDelimitersSpanTest, MatchVectorResults) {
+    for (size_t length : {0, 1, 63, 64, 65, 1023, 1024, 1025, 5000}) {
+        std::string data = test_data::delimiters::generate_test_string(length, length / 6);
+        auto expected = find_delimiters_scalar(data, '|');
+
+        std::vector<uint32_t> out32(expected.size());
+        std::vector<uint16_t> out16(expected.size());
+
+        EXPECT_EQ(find_delimiters_simd(data, '|', std::span<uint32_t>(out32)), expected.size());
+        EXPECT_EQ(find_delimiters_simd(data, '|', std::span<uint16_t>(out16)), expected.size());
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out32.begin())) << "Length: " << length;
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out16.begin())) << "Length: " << length;
+
+        std::vector<uint32_t> scalar32(expected.size());
+        std::vector<uint16_t> scalar16(expected.size());
+        EXPECT_EQ(find_delimiters_scalar(data, '|', std::span<uint32_t>(scalar32)), expected.size());
+        EXPECT_EQ(find_delimiters_scalar(data, '|', std::span<uint16_t>(scalar16)), expected.size());
+        EXPECT_EQ(scalar32, out32);
+        EXPECT_EQ(scalar16, out16);
+    }
+}
+
+TEST(FindDelimitersSpanTest, AllTiers_MatchScalar) {
+    // Dense and sparse inputs, so blocks with 0, a few and 64 matches occur
+    for (size_t length : {1, 63, 64, 65, 200, 1025, 5000}) {
+        for (size_t count : {length / 40, length / 3, length}) {
+            std::string data = test_data::delimiters::generate_test_string(length, count);
+            auto expected = find_delimiters_scalar(data, '|');
+
+            for (SimdLevel level : test_data::supported_levels()) {
+                std::vector<uint32_t> out32(expected.size());
+                std::vector<uint16_t> out16(expected.size());
+
+                EXPECT_EQ(find_delimiters_simd(data, '|', std::span<uint32_t>(out32), level), expected.size());
+                EXPECT_EQ(find_delimiters_simd(data, '|', std::span<uint16_t>(out16), level), expected.size());
+                EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out32.begin()))
+                    << "Tier: " << simd_level_name(level) << " Length: " << length << " Count: " << count;
+                EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out16.begin()))
+                    << "Tier: " << simd_level_name(level) << " Length: " << length << " Count: " << count;
+            }
+        }
+    }
+}
+
+TEST(FindDelimitersSpanTest, AllTiers_NoWritePastMatches) {
+    // Every byte is a delimiter; the guard slots after the span must survive
+    std::string data(130, '|');
+
+    for (SimdLevel level : test_data::supported_levels()) {
+        for (size_t capacity : {0, 1, 63, 64, 65, 129, 130}) {
+            std::vector<uint32_t> buffer(capacity + 8, 0xDEADBEEF);
+            size_t count = find_delimiters_simd(data, '|', std::span<uint32_t>(buffer.data(), capacity), level);
+
+            EXPECT_EQ(count, data.size()) << "Tier: " << simd_level_name(level);
+            for (size_t i = 0; i < capacity; ++i) {
+                ASSERT_EQ(buffer[i], i) << "Tier: " << simd_level_name(level) << " Capacity: " << capacity;
+            }
+            for (size_t i = capacity; i < buffer.size(); ++i) {
+                ASSERT_EQ(buffer[i], 0xDEADBEEF) << "Tier: " << simd_level_name(level) << " Capacity: " << capacity;
+            }
+        }
+    }
+}
+
+TEST(FindDelimitersSpanTest, OverflowReportsTotalCount) {
+    const std::string& msg = test_data::valid::NEW_ORDER_SINGLE;
+    auto expected = find_delimiters_scalar(msg, '|');
+    ASSERT_GT(expected.size(), 3u);
+
+    uint32_t simd_out[3] = {};
+    uint32_t scalar_out[3] = {};
+
+    EXPECT_EQ(find_delimiters_simd(msg, '|', std::span<uint32_t>(simd_out)), expected.size());
+    EXPECT_EQ(find_delimiters_scalar(msg, '|', std::span<uint32_t>(scalar_out)), expected.size());
+
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(simd_out[i], expected[i]);
+        EXPECT_EQ(scalar_out[i], expected[i]);
+    }
+}
+
+TEST(FindDelimitersSpanTest, EmptyOutputOnlyCounts) {
+    std::string data = test_data::delimiters::generate_test_string(2000, 150);
+
+    EXPECT_EQ(find_delimiters_simd(data, '|', std::span<uint32_t>()), 150u);
+}
+
+TEST(FindDelimitersSpanTest, Uint16RejectsOversizedInput) {
+    std::string data(MAX_UINT16_SCAN_SIZE + 1, '|');
+    uint16_t out[4];
+
+    EXPECT_EQ(find_delimiters_simd(data, '|', std::span<uint16_t>(out)), DELIMITER_SCAN_TOO_LARGE);
+    EXPECT_EQ(find_delimiters_scalar(data, '|', std::span<uint16_t>(out)), DELIMITER_SCAN_TOO_LARGE);
+
+    // Exactly 64 KiB still fits: the last position is 65535
+    data.pop_back();
+    std::vector<uint16_t> all(data.size());
+    EXPECT_EQ(find_delimiters_simd(data, '|', std::span<uint16_t>(all)), data.size());
+    EXPECT_EQ(all.back(), 65535);
+}
+
+// ============================================================================
+// Structural Index Tests
+// ============================================================================
+
+TEST(StructuralIndexTest, AllTiers_MatchDelimiterPositions) {
+    for (size_t length : {0, 1, 15, 16, 63, 64, 65, 127, 128, 129, 300}) {
+        std::string data = test_data::delimiters::generate_test_string(length, length / 5);
+        for (size_t i = 3; i < data.size(); i += 11) {
+            data[i] = '=';
+        }
+
+        for (SimdLevel level : test_data::supported_levels()) {
+            StructuralIndex index;
+            build_structural_index(data, '|', index, level);
+
+            ASSERT_EQ(index.length, data.size());
+            ASSERT_EQ(index.delimiter_masks.size(), (data.size() + 63) / 64);
+
+            for (size_t i = 0; i < data.size(); ++i) {
+                const bool delim_bit = (index.delimiter_masks[i / 64] >> (i % 64)) & 1;
+                const bool equals_bit = (index.equals_masks[i / 64] >> (i % 64)) & 1;
+                EXPECT_EQ(delim_bit, data[i] == '|')
+                    << "Tier: " << simd_level_name(level) << " Pos: " << i;
+                EXPECT_EQ(equals_bit, data[i] == '=')
+                    << "Tier: " << simd_level_name(level) << " Pos: " << i;
+            }
+        }
+    }
+}
+
+TEST(StructuralIndexTest, AllTiers_NoBitsPastEnd) {
+    // A NUL delimiter would match the zero padding of a partial block
+    std::string data(70, '\0');
+
+    for (SimdLevel level : test_data::supported_levels()) {
+        StructuralIndex index;
+        build_structural_index(data, '\0', index, level);
+
+        EXPECT_EQ(index.delimiter_masks[1], (uint64_t{1} << 6) - 1)
+            << "Tier: " << simd_level_name(level);
+    }
+}
+
+TEST(StructuralIndexTest, MatchMasksAgreeWithIndex) {
+    std::string data = test_data::invalid::generate_long_message(5);
+    StructuralIndex index;
+    build_structural_index(data, '|', index);
+
+    std::vector<uint64_t> masks((data.size() + 63) / 64);
+    build_match_masks(data, '|', masks.data());
+    EXPECT_EQ(masks, index.delimiter_masks);
+
+    build_match_masks(data, '=', masks.data());
+    EXPECT_EQ(masks, index.equals_masks);
+}
+
+TEST(StructuralIndexTest, AllTiers_ByteSum) {
+    for (size_t size = 0; size < 300; size += 7) {
+        std::string data(size, '\0');
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<char>(0x80 + i * 31);  // High-bit bytes included
+        }
+        uint32_t expected = 0;
+        for (char c : data) {
+            expected += static_cast<uint8_t>(c);
+        }
+
+        for (SimdLevel level : test_data::supported_levels()) {
+            StructuralIndex index;
+            build_structural_index(data, '|', index, level);
+            EXPECT_EQ(index.byte_sum, expected)
+                << "Tier: " << simd_level_name(level) << ", size: " << size;
+        }
+    }
+}
+
+TEST(StructuralIndexTest, ReuseKeepsCapacity) {
+    StructuralIndex index;
+    build_structural_index(test_data::invalid::generate_long_message(10), '|', index);
+    const uint64_t* storage = index.delimiter_masks.data();
+
+    build_structural_index(test_data::valid::NEW_ORDER_SINGLE, '|', index);
+
+    EXPECT_EQ(index.delimiter_masks.data(), storage);
+    EXPECT_EQ(index.length, test_data::valid::NEW_ORDER_SINGLE.size());
+}
+
+TEST(FieldWalkerTest, SimpleMessage) {
+    FieldList expected = {{"8", "FIX.4.4"}, {"35", "D"}, {"55", "AAPL"}};
+
+    EXPECT_EQ(collect_fields("8=FIX.4.4|35=D|55=AAPL|"), expected);
+}
+
+TEST(FieldWalkerTest, TrailingFieldWithoutDelimiter) {
+    FieldList expected = {{"35", "D"}, {"55", "AAPL"}};
+
+    EXPECT_EQ(collect_fields("35=D|55=AAPL"), expected);
+}
+
+TEST(FieldWalkerTest, SkipsMalformedAndEmptyFields) {
+    FieldList expected = {{"35", ""}, {"55", "AAPL"}};
+
+    EXPECT_EQ(collect_fields("||35=|NOEQUALS|=X|55=AAPL||"), expected);
+}
+
+TEST(FieldWalkerTest, EqualsInsideValue) {
+    FieldList expected = {{"58", "a=b=c"}, {"55", "X"}};
+
+    EXPECT_EQ(collect_fields("58=a=b=c|55=X|"), expected);
+}
+
+TEST(FieldWalkerTest, FieldsStraddleBlockBoundaries) {
+    // Put the '=' and the delimiter of a long field in different blocks
+    std::string value(100, 'V');
+    std::string data = "35=D|" + std::string(58, 'T') + "=" + value + "|55=AAPL|";
+    FieldList expected = {{"35", "D"}, {std::string(58, 'T'), value}, {"55", "AAPL"}};
+
+    EXPECT_EQ(collect_fields(data), expected);
+}
+
+TEST(FieldWalkerTest, DelimiterOnLastBitOfBlock) {
+    std::string data = "1=" + std::string(61, 'x') + "|2=y|";
+    ASSERT_EQ(data[63], '|');
+    FieldList expected = {{"1", std::string(61, 'x')}, {"2", "y"}};
+
+    EXPECT_EQ(collect_fields(data), expected);
+}
+
+TEST(FieldWalkerTest, SOHDelimiter) {
+    FieldList expected = {{"35", "D"}, {"55", "IBM"}};
+
+    EXPECT_EQ(collect_fields("35=D\x01" "55=IBM\x01", '\x01'), expected);
+}
+
+// ============================================================================
+// CheckSum Tests
+// ============================================================================
+
+TEST(ChecksumTest, SimdMatchesScalarAcrossSizes) {
+    std::string data;
+    for (size_t size = 0; size < 300; ++size) {
+        EXPECT_EQ(compute_checksum_simd(data), compute_checksum_scalar(data)) << "Size: " << size;
+        data += static_cast<char>(size * 37);
+    }
+}
+
+TEST(ChecksumTest, KnownValue) {
+    // '1' + '|' = 49 + 124 = 173; 'A' * 4 = 260 -> 4
+    EXPECT_EQ(compute_checksum_scalar("1|"), 173);
+    EXPECT_EQ(compute_checksum_simd("AAAA"), 4);
+}
+
+// ============================================================================
+// Numeric Parsing Tests
+// ============================================================================
+
+TEST(ParseIntTest, TableCases) {
+    for (const auto& [input, expected] : test_data::numeric::INT_CASES) {
+        EXPECT_EQ(parse_int(input), expected) << "Input: " << input;
+    }
+}
+
+TEST(ParseIntTest, EveryLength) {
+    // Covers the byte-assembled, overlapping-load and from_chars paths
+    std::string digits;
+    for (size_t length = 1; length <= 10; ++length) {
+        digits += static_cast<char>('1' + (length % 9));
+        const int64_t expected = std::stoll(digits);
+        if (expected > INT32_MAX) {
+            break;
+        }
+        EXPECT_EQ(parse_int(digits), expected) << "Input: " << digits;
+        EXPECT_EQ(parse_int("-" + digits), -expected) << "Input: -" << digits;
+    }
+}
+
+TEST(ParseIntTest, TrailingGarbageKeepsLeadingDigits) {
+    // Same result as before the SWAR path: from_chars stops at the first non-digit
+    EXPECT_EQ(parse_int("123abc"), 123);
+    EXPECT_EQ(parse_int("42.5"), 42);
+    EXPECT_EQ(parse_int("-7x"), -7);
+    EXPECT_EQ(parse_int(""), 0);
+    EXPECT_EQ(parse_int("-"), 0);
+    EXPECT_EQ(parse_int("A"), 0);
+}
+
+TEST(ParseInt64Test, TableCases) {
+    for (const auto& [input, expected] : test_data::numeric::INT64_CASES) {
+        EXPECT_EQ(parse_int64(input), expected) << "Input: " << input;
+    }
+}
+
+TEST(ParseInt64Test, EveryLengthAndNonDigitPosition) {
+    for (size_t length = 1; length <= MAX_SIMD_INT_DIGITS; ++length) {
+        std::string digits;
+        for (size_t i = 0; i < length; ++i) {
+            digits += static_cast<char>('0' + (i * 7 + 3) % 10);
+        }
+        EXPECT_EQ(parse_int64(digits), std::stoll(digits)) << "Input: " << digits;
+
+        // A non-digit anywhere leaves the digits before it
+        for (size_t pos = 0; pos < length; ++pos) {
+            std::string input = digits;
+            input[pos] = ':';
+            const int64_t expected = pos == 0 ? 0 : std::stoll(digits.substr(0, pos));
+            EXPECT_EQ(parse_int64(input), expected) << "Input: " << input;
+        }
+    }
+}
+
+TEST(ParseInt64Test, DigitsAtStartOfBuffer) {
+    // The vector kernel right-aligns with a masked load that starts before
+    // the run; masked-off bytes must not be touched
+    std::vector<char> buffer = {'9', '8', '7'};
+    EXPECT_EQ(parse_int64(std::string_view(buffer.data(), buffer.size())), 987);
+}
+
+TEST(ParseDoubleTest, TableCases) {
+    for (const auto& [input, expected] : test_data::numeric::DOUBLE_CASES) {
+        EXPECT_DOUBLE_EQ(parse_double(input), expected) << "Input: " << input;
+    }
+}
+
+// ============================================================================
+// Batch Conversion Tests
+// ============================================================================
+
+namespace {
+
+// Mix of vector-path values and ones that need the scalar fallback, long
+// enough for full vectors plus a tail
+std::vector<std::string_view> mixed_numbers() {
+    static const std::vector<std::string> values = [] {
+        std::vector<std::string> v = {
+            "1", "2", "-7", "100", "12345678", "-12345678", "123456789", "2147483647",
+            "", "-", "12a", "150.25", "0.0001", "-1.5", "99999999", "1e5",
+            "5.", ".5", "628450.00", "00000042", "1234.5678", "12345.678", "1.2.3", "x",
+            "150.250000", "-0.0", "1234567.123456789", "0.000000000000001", "12345678901234567",
+            "9007199254740993", "-4503599627370495", "1.5x",
+        };
+        for (const auto& [input, expected] : test_data::numeric::INT_CASES) {
+            v.push_back(input);
+        }
+        for (const auto& [input, expected] : test_data::numeric::DOUBLE_CASES) {
+            v.push_back(input);
+        }
+        return v;
+    }();
+    return std::vector<std::string_view>(values.begin(), values.end());
+}
+
+} // namespace
+
+TEST(ParseBatchTest, IntsMatchParseInt) {
+    const std::vector<std::string_view> values = mixed_numbers();
+    for (size_t count = 0; count <= values.size(); count += 3) {
+        std::vector<int32_t> out(count, -1);
+        parse_int_batch(std::span(values.data(), count), out);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(out[i], parse_int(values[i])) << "Input: " << values[i];
+        }
+    }
+}
+
+TEST(ParseBatchTest, PricesMatchParsePrice) {
+    const std::vector<std::string_view> values = mixed_numbers();
+    std::vector<double> prices(values.size());
+    std::vector<Decimal64> decimals(values.size(), Decimal64{9, 9});
+    parse_price_batch(values, prices, decimals);
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        Decimal64 expected_decimal;
+        const double expected = parse_price(values[i], expected_decimal);
+        EXPECT_EQ(prices[i], expected) << "Input: " << values[i];
+        EXPECT_EQ(decimals[i].mantissa, expected_decimal.mantissa) << "Input: " << values[i];
+        EXPECT_EQ(decimals[i].exponent, expected_decimal.exponent) << "Input: " << values[i];
+    }
+}
+
+// ============================================================================
+// Decimal Parsing Tests
+// ============================================================================
+
+TEST(ParseDecimalTest, TableCases) {
+    for (const auto& test_case : test_data::numeric::DECIMAL_CASES) {
+        Decimal64 value;
+        ASSERT_TRUE(parse_decimal(test_case.input, value)) << "Input: " << test_case.input;
+        EXPECT_EQ(value.mantissa, test_case.mantissa) << "Input: " << test_case.input;
+        EXPECT_EQ(value.exponent, test_case.exponent) << "Input: " << test_case.input;
+    }
+}
+
+TEST(ParseDecimalTest, InvalidNumbersRejected) {
+    for (const std::string& input : test_data::numeric::INVALID_NUMBERS) {
+        Decimal64 value{7, -1};
+        EXPECT_FALSE(parse_decimal(input, value)) << "Input: " << input;
+        EXPECT_EQ(value.mantissa, 7) << "Input: " << input;
+        EXPECT_EQ(parse_decimal(input), Decimal64{}) << "Input: " << input;
+    }
+
+    // 19 digits no longer fit the mantissa
+    Decimal64 value;
+    EXPECT_FALSE(parse_decimal("1234567890.123456789", value));
+    EXPECT_FALSE(parse_decimal("-", value));
+}
+
+TEST(ParseDecimalTest, NonDigitInEveryPosition) {
+    // The digit check covers each byte of a chunk, including short chunks
+    for (size_t length = 1; length <= 16; ++length) {
+        for (size_t pos = 0; pos < length; ++pos) {
+            std::string input(length, '7');
+            input[pos] = '/';
+            Decimal64 value;
+            EXPECT_FALSE(parse_decimal(input, value)) << "Input: " << input;
+            input[pos] = ':';
+            EXPECT_FALSE(parse_decimal(input, value)) << "Input: " << input;
+        }
+    }
+}
+
+TEST(ParseDecimalTest, MatchesParseDouble) {
+    for (const auto& [input, expected] : test_data::numeric::DOUBLE_CASES) {
+        EXPECT_DOUBLE_EQ(parse_decimal(input).to_double(), expected) << "Input: " << input;
+    }
+}
+
+TEST(ParseDecimalTest, ExactWhereDoubleIsNot) {
+    // 0.1 + 0.2 != 0.3 in binary floating point; the decimals add exactly
+    Decimal64 a = parse_decimal("0.1");
+    Decimal64 b = parse_decimal("0.2");
+    EXPECT_EQ(a.rescale(-2) + b.rescale(-2), parse_decimal("0.30").mantissa);
+}
+
+TEST(ParsePriceTest, FallsBackForNonDecimalInput) {
+    Decimal64 decimal{5, 0};
+    EXPECT_DOUBLE_EQ(parse_price("1e5", decimal), 100000.0);
+    EXPECT_EQ(decimal, Decimal64{});
+
+    EXPECT_DOUBLE_EQ(parse_price("150.25", decimal), 150.25);
+    EXPECT_EQ(decimal, (Decimal64{15025, -2}));
+}
+
+TEST(ParsePriceTest, FallbackOnlyWhereDecimalIsInexact) {
+    Decimal64 decimal;
+    EXPECT_EQ(parse_price_fallback("150.25", decimal), 0.0);
+    EXPECT_EQ(decimal, (Decimal64{15025, -2}));
+    EXPECT_EQ(parse_price_fallback("0", decimal), 0.0);
+    EXPECT_EQ(decimal, Decimal64{});
+
+    EXPECT_DOUBLE_EQ(parse_price_fallback("1e5", decimal), 100000.0);
+    EXPECT_EQ(decimal, Decimal64{});
+    EXPECT_EQ(parse_price_fallback("9007199254740993", decimal), 9007199254740992.0);
+    EXPECT_EQ(decimal, (Decimal64{9007199254740993, 0}));
+}
+
+TEST(ParsePriceTest, LongMantissasRoundCorrectly) {
+    // 16-18 digit decimals exceed 2^53; they must still match strtod
+    std::vector<std::string> inputs = {"7485341534.85358512", "9007199254740993", "0.9007199254740993",
+                                       "-123456789.012345678", "999999999999999999"};
+    std::mt19937_64 rng(16);
+    for (int i = 0; i < 2000; ++i) {
+        const int digits = 16 + i % 3;
+        const int point = static_cast<int>(rng() % digits);
+        std::string input;
+        for (int d = 0; d < digits; ++d) {
+            if (d == point && d != 0) {
+                input += '.';
+            }
+            input += static_cast<char>('0' + (d == 0 ? 1 + rng() % 9 : rng() % 10));
+        }
+        inputs.push_back(input);
+    }
+
+    std::vector<std::string_view> views(inputs.begin(), inputs.end());
+    std::vector<double> prices(views.size());
+    std::vector<Decimal64> decimals(views.size());
+    parse_price_batch(views, prices, decimals);
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const std::string& input = inputs[i];
+        const double expected = std::strtod(input.c_str(), nullptr);
+        Decimal64 decimal;
+        EXPECT_EQ(parse_double(input), expected) << "Input: " << input;
+        EXPECT_EQ(parse_price(input, decimal), expected) << "Input: " << input;
+        const double fallback = parse_price_fallback(input, decimal);
+        EXPECT_EQ(fallback != 0.0 ? fallback : decimal.to_double(), expected) << "Input: " << input;
+        EXPECT_EQ(prices[i], expected) << "Input: " << input;
+        // The exact decimal is still kept
+        EXPECT_EQ(decimal, parse_decimal(input)) << "Input: " << input;
+        EXPECT_NE(decimal.mantissa, 0) << "Input: " << input;
+    }
+}
+
+TEST(Decimal64Test, Rescale) {
+    Decimal64 price{15025, -2};
+    EXPECT_EQ(price.rescale(-4), 1502500);
+    EXPECT_EQ(price.rescale(-1), 1502);
+    EXPECT_EQ(price.rescale(0), 150);
+    EXPECT_EQ((Decimal64{-15025, -2}).rescale(0), -150);
+}
+
+TEST(Decimal64Test, EqualityIgnoresTrailingZeros) {
+    EXPECT_EQ(parse_decimal("150.25"), parse_decimal("150.250"));
+    EXPECT_EQ(parse_decimal("150"), parse_decimal("150.00"));
+    EXPECT_NE(parse_decimal("150.25"), parse_decimal("150.26"));
+}
+
+// ============================================================================
+// Timestamp Parsing Tests
+// ============================================================================
+
+TEST(ParseTimestampTest, KnownValues) {
+    EXPECT_EQ(parse_timestamp("19700101-00:00:00"), 0);
+    EXPECT_EQ(parse_timestamp("20240115-14:30:00"), 1705329000000000000);
+    EXPECT_EQ(parse_timestamp("20240229-23:59:59"), 1709251199000000000);
+    EXPECT_EQ(parse_timestamp("20261015-13:45:12"), 1792071912000000000);
+    EXPECT_EQ(parse_timestamp("19691231-23:59:59"), -1000000000);
+}
+
+TEST(ParseTimestampTest, FractionalSeconds) {
+    const int64_t base = 1705329000000000000;
+    EXPECT_EQ(parse_timestamp("20240115-14:30:00.1"), base + 100000000);
+    EXPECT_EQ(parse_timestamp("20240115-14:30:00.123"), base + 123000000);
+    EXPECT_EQ(parse_timestamp("20240115-14:30:00.123456"), base + 123456000);
+    EXPECT_EQ(parse_timestamp("20240115-14:30:00.123456789"), base + 123456789);
+}
+
+TEST(ParseTimestampTest, LeapSecondAccepted) {
+    int64_t nanos = 0;
+    EXPECT_TRUE(parse_timestamp("20161231-23:59:60", nanos));
+    EXPECT_EQ(nanos, parse_timestamp("20170101-00:00:00"));
+}
+
+TEST(ParseTimestampTest, InvalidRejected) {
+    const char* cases[] = {
+        "",
+        "2024011514:30:00",             // 16 bytes
+        "20240115-14:30:0",             // 16 bytes
+        "20240115-14:30:000",           // 18 bytes, no '.'
+        "20240115-14:30:00.",           // '.' without digits
+        "20240115-14:30:00.1234567890", // 10 fraction digits
+        "20240115 14:30:00",
+        "20240115-14-30-00",
+        "20241315-14:30:00",            // month 13
+        "20240015-14:30:00",            // month 0
+        "20240230-14:30:00",            // Feb 30
+        "20230229-14:30:00",            // not a leap year
+        "20240100-14:30:00",            // day 0
+        "20240115-24:00:00",
+        "20240115-14:60:00",
+        "20240115-14:30:61",
+        "20240115-14:30:00.12a",
+    };
+    for (const char* input : cases) {
+        int64_t nanos = 42;
+        EXPECT_FALSE(parse_timestamp(input, nanos)) << "Input: " << input;
+        EXPECT_FALSE(parse_timestamp_scalar(input, nanos)) << "Input: " << input;
+        EXPECT_EQ(parse_timestamp(input), 0) << "Input: " << input;
+    }
+}
+
+TEST(ParseTimestampTest, NonDigitAtEveryPosition) {
+    const std::string valid = "20240115-14:30:00.123";
+    for (size_t pos = 0; pos < valid.size(); ++pos) {
+        if (valid[pos] < '0' || valid[pos] > '9') {
+            continue;
+        }
+        for (char bad : {'/', ':', 'A', ' '}) {
+            std::string input = valid;
+            input[pos] = bad;
+            int64_t nanos = 0;
+            EXPECT_FALSE(parse_timestamp(input, nanos)) << "Input: " << input;
+        }
+    }
+}
+
+TEST(ParseTimestampTest, VectorMatchesScalar) {
+    // Every month end in a leap and a non-leap year, with varied clocks
+    for (int year : {1999, 2000, 2023, 2024, 2100}) {
+        for (int month = 1; month <= 12; ++month) {
+            for (int day : {1, 28, 29, 30, 31}) {
+                char input[32];
+                std::snprintf(input, sizeof(input), "%04d%02d%02d-%02d:%02d:%02d.%03d",
+                              year, month, day, (day * 7) % 24, (month * 11) % 60,
+                              (year + day) % 60, (month * day) % 1000);
+                int64_t simd = 0;
+                int64_t scalar = 0;
+                const bool simd_ok = parse_timestamp(input, simd);
+                EXPECT_EQ(simd_ok, parse_timestamp_scalar(input, scalar)) << "Input: " << input;
+                EXPECT_EQ(simd, scalar) << "Input: " << input;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,148 @@
+/**
+ * Symbol Table Unit Tests
+ *
+ * Tests for SymbolTable interning and for symbol_id as filled in by the
+ * parsers when a table is attached to the ParserContext.
+ */
+
+#include <gtest/gtest.h>
+#include "parser.hpp"
+#include "symbol_table.hpp"
+#include "test_data.hpp"
+#include <string>
+#include <vector>
+
+using namespace simd_parser;
+
+// ============================================================================
+// Interning Tests
+// ============================================================================
+
+TEST(SymbolTableTest, DenseIdsInOrderOfFirstSight) {
+    SymbolTable table;
+
+    EXPECT_EQ(table.intern("AAPL"), 0u);
+    EXPECT_EQ(table.intern("MSFT"), 1u);
+    EXPECT_EQ(table.intern("AAPL"), 0u);
+    EXPECT_EQ(table.intern("GOOGL"), 2u);
+    EXPECT_EQ(table.size(), 3u);
+
+    EXPECT_EQ(table.name(0), "AAPL");
+    EXPECT_EQ(table.name(1), "MSFT");
+    EXPECT_EQ(table.name(2), "GOOGL");
+}
+
+TEST(SymbolTableTest, FindDoesNotInsert) {
+    SymbolTable table;
+    table.intern("IBM");
+
+    EXPECT_EQ(table.find("IBM"), 0u);
+    EXPECT_EQ(table.find("IBMX"), NO_SYMBOL_ID);
+    EXPECT_EQ(table.size(), 1u);
+}
+
+TEST(SymbolTableTest, EmptySymbolHasNoId) {
+    SymbolTable table;
+
+    EXPECT_EQ(table.intern(""), NO_SYMBOL_ID);
+    EXPECT_EQ(table.find(""), NO_SYMBOL_ID);
+    EXPECT_EQ(table.size(), 0u);
+}
+
+TEST(SymbolTableTest, PackedAndHashedKeysDoNotCollide) {
+    // Lengths on both sides of the 8-byte packed key, prefixes of each
+    // other, a non-ASCII eighth byte and embedded NULs
+    const std::vector<std::string> symbols = {
+        "A", "AB", "ABCDEFG", "ABCDEFGH", "ABCDEFGHI", "ABCDEFGHIJKLMNOPQ",
+        "ESZ4 Comdty", "ABCDEFG\xC3", std::string(1, '\0'), std::string(8, '\0'),
+        std::string("A\0B", 3), std::string("A\0", 2),
+    };
+
+    SymbolTable table;
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        EXPECT_EQ(table.intern(symbols[i]), i) << "Symbol " << i;
+    }
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        EXPECT_EQ(table.find(symbols[i]), i) << "Symbol " << i;
+        EXPECT_EQ(table.name(static_cast<uint32_t>(i)), symbols[i]) << "Symbol " << i;
+    }
+}
+
+TEST(SymbolTableTest, GrowsPastInitialCapacity) {
+    SymbolTable table(4);
+    const size_t initial_capacity = table.capacity();
+
+    std::vector<std::string> symbols;
+    for (size_t i = 0; i < 5000; ++i) {
+        // Short tickers and long identifiers, so both key kinds are rehashed
+        std::string symbol = i % 3 == 0 ? "LONGSYMBOL-" : "S";
+        symbols.push_back(symbol.append(std::to_string(i)));
+    }
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        ASSERT_EQ(table.intern(symbols[i]), i) << symbols[i];
+    }
+
+    EXPECT_GT(table.capacity(), initial_capacity);
+    EXPECT_LE(table.size() * 8, table.capacity() * 7);
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        EXPECT_EQ(table.find(symbols[i]), i) << symbols[i];
+    }
+}
+
+TEST(SymbolTableTest, NameViewsSurviveGrowth) {
+    SymbolTable table(4);
+    const std::string_view first = table.name(table.intern("AAPL"));
+    for (size_t i = 0; i < 1000; ++i) {
+        table.intern(std::to_string(i));
+    }
+    EXPECT_EQ(first, "AAPL");
+}
+
+// ============================================================================
+// Parser Integration Tests
+// ============================================================================
+
+TEST(SymbolTableTest, ParsersFillSymbolId) {
+    SymbolTable table;
+    ParserContext context;
+    context.symbols = &table;
+
+    auto simd = parse_simd(test_data::valid::NEW_ORDER_SINGLE, context);
+    auto scalar = parse_scalar(test_data::valid::NEW_ORDER_SINGLE, context);
+    auto report = parse_simd(test_data::valid::EXECUTION_REPORT, context);
+    auto masked = parse_simd(test_data::valid::EXECUTION_REPORT, context,
+                             FieldMask{FIXTag::MessageType, FIXTag::Symbol});
+
+    EXPECT_EQ(simd.symbol_id, table.find(simd.symbol));
+    EXPECT_EQ(scalar.symbol_id, simd.symbol_id);
+    EXPECT_NE(report.symbol_id, simd.symbol_id);
+    EXPECT_EQ(masked.symbol_id, report.symbol_id);
+    EXPECT_EQ(table.name(report.symbol_id), "MSFT");
+}
+
+TEST(SymbolTableTest, BatchMatchesSingleMessageIds) {
+    std::vector<std::string> storage = test_data::generate_message_batch(40);
+    std::vector<std::string_view> messages(storage.begin(), storage.end());
+
+    SymbolTable table;
+    ParserContext context;
+    context.symbols = &table;
+    std::vector<FIXMessage> batch(messages.size());
+    parse_simd_batch(messages, context, batch);
+
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(batch[i].symbol_id, parse_simd(messages[i], context).symbol_id) << "Message " << i;
+        EXPECT_EQ(table.name(batch[i].symbol_id), batch[i].symbol) << "Message " << i;
+    }
+}
+
+TEST(SymbolTableTest, NoTableOrNoSymbolLeavesNoId) {
+    SymbolTable table;
+    ParserContext context;
+
+    EXPECT_EQ(parse_simd(test_data::valid::NEW_ORDER_SINGLE, context).symbol_id, NO_SYMBOL_ID);
+
+    context.symbols = &table;
+    EXPECT_EQ(parse_simd(test_data::invalid::NO_SYMBOL, context).symbol_id, NO_SYMBOL_ID);
+    EXPECT_EQ(table.size(), 0u);
+}
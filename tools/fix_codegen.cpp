@@ -0,0 +1,461 @@
+/**
+ * fix_codegen: generates message structs and parser tables from a
+ * QuickFIX-style XML data dictionary.
+ *
+ * Usage: fix_codegen <dictionary.xml> <output.hpp> <namespace>
+ *
+ * For every <message>, the output holds a struct with one typed member per
+ * field (standard header fields first, components inlined), a constexpr
+ * tag → slot table, a set() switch over those slots and a required-field
+ * bitmask. parse_message() in dictionary_parser.hpp drives them.
+ *
+ * Only the XML the QuickFIX dictionaries use is understood: elements,
+ * quoted attributes, comments and the prolog. Repeating groups are not
+ * generated; they are listed in a comment on the struct.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// ============================================================================
+// Minimal XML reader
+// ============================================================================
+
+struct XmlElement {
+    std::string name;
+    std::map<std::string, std::string> attributes;
+    std::vector<std::unique_ptr<XmlElement>> children;
+
+    std::string attribute(const std::string& key) const {
+        auto it = attributes.find(key);
+        return it == attributes.end() ? std::string() : it->second;
+    }
+
+    const XmlElement* child(const std::string& child_name) const {
+        for (const auto& c : children) {
+            if (c->name == child_name) {
+                return c.get();
+            }
+        }
+        return nullptr;
+    }
+};
+
+class XmlReader {
+public:
+    explicit XmlReader(std::string text) : text_(std::move(text)) {}
+
+    std::unique_ptr<XmlElement> parse_document() {
+        skip_misc();
+        auto root = parse_element();
+        skip_misc();
+        if (pos_ != text_.size()) {
+            fail("unexpected content after the root element");
+        }
+        return root;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& message) const {
+        size_t line = 1;
+        for (size_t i = 0; i < pos_ && i < text_.size(); ++i) {
+            line += text_[i] == '\n';
+        }
+        throw std::runtime_error("line " + std::to_string(line) + ": " + message);
+    }
+
+    bool starts_with(const char* prefix) const {
+        return text_.compare(pos_, std::char_traits<char>::length(prefix), prefix) == 0;
+    }
+
+    void skip_whitespace() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            ++pos_;
+        }
+    }
+
+    void skip_past(const char* terminator) {
+        size_t end = text_.find(terminator, pos_);
+        if (end == std::string::npos) {
+            fail(std::string("missing '") + terminator + "'");
+        }
+        pos_ = end + std::char_traits<char>::length(terminator);
+    }
+
+    // Whitespace, comments, the <?xml ?> prolog and text between elements
+    void skip_misc() {
+        for (;;) {
+            while (pos_ < text_.size() && text_[pos_] != '<') {
+                ++pos_;
+            }
+            if (starts_with("<!--")) {
+                skip_past("-->");
+            } else if (starts_with("<?") || starts_with("<!")) {
+                skip_past(">");
+            } else {
+                return;
+            }
+        }
+    }
+
+    std::string parse_name() {
+        size_t start = pos_;
+        while (pos_ < text_.size() &&
+               (std::isalnum(static_cast<unsigned char>(text_[pos_])) || text_[pos_] == '_' ||
+                text_[pos_] == '-' || text_[pos_] == ':' || text_[pos_] == '.')) {
+            ++pos_;
+        }
+        if (pos_ == start) {
+            fail("expected a name");
+        }
+        return text_.substr(start, pos_ - start);
+    }
+
+    std::unique_ptr<XmlElement> parse_element() {
+        if (!starts_with("<")) {
+            fail("expected '<'");
+        }
+        ++pos_;
+        auto element = std::make_unique<XmlElement>();
+        element->name = parse_name();
+
+        for (;;) {
+            skip_whitespace();
+            if (starts_with("/>")) {
+                pos_ += 2;
+                return element;
+            }
+            if (starts_with(">")) {
+                ++pos_;
+                break;
+            }
+            std::string key = parse_name();
+            skip_whitespace();
+            if (!starts_with("=")) {
+                fail("expected '=' after attribute " + key);
+            }
+            ++pos_;
+            skip_whitespace();
+            const char quote = pos_ < text_.size() ? text_[pos_] : '\0';
+            if (quote != '"' && quote != '\'') {
+                fail("expected a quoted value for attribute " + key);
+            }
+            size_t end = text_.find(quote, pos_ + 1);
+            if (end == std::string::npos) {
+                fail("unterminated value for attribute " + key);
+            }
+            element->attributes[key] = text_.substr(pos_ + 1, end - pos_ - 1);
+            pos_ = end + 1;
+        }
+
+        for (;;) {
+            skip_misc();
+            if (pos_ >= text_.size()) {
+                fail("unterminated element <" + element->name + ">");
+            }
+            if (starts_with("</")) {
+                pos_ += 2;
+                if (parse_name() != element->name) {
+                    fail("mismatched closing tag for <" + element->name + ">");
+                }
+                skip_past(">");
+                return element;
+            }
+            element->children.push_back(parse_element());
+        }
+    }
+
+    std::string text_;
+    size_t pos_ = 0;
+};
+
+// ============================================================================
+// Dictionary model
+// ============================================================================
+
+struct FieldDef {
+    uint32_t number;
+    std::string name;
+    std::string type;
+};
+
+struct MessageField {
+    const FieldDef* def;
+    bool required;
+};
+
+struct MessageDef {
+    std::string name;
+    std::string msg_type;
+    std::vector<MessageField> fields;
+    std::vector<std::string> skipped_groups;
+};
+
+// Tags handled by parse_message() itself rather than stored in the struct
+const std::set<uint32_t> FRAMING_TAGS = {8, 9, 10, 35};
+
+struct CppType {
+    const char* type;
+    const char* init;        // Default member initializer
+    const char* conversion;  // Expression over `value`
+};
+
+CppType cpp_type(const std::string& fix_type) {
+    static const std::set<std::string> integers = {
+        "INT", "SEQNUM", "LENGTH", "NUMINGROUP", "DAYOFMONTH", "TAGNUM"};
+    static const std::set<std::string> decimals = {
+        "PRICE", "QTY", "AMT", "FLOAT", "PRICEOFFSET", "PERCENTAGE"};
+
+    if (integers.count(fix_type)) {
+        return {"int32_t", "0", "parse_int(value)"};
+    }
+    if (decimals.count(fix_type)) {
+        return {"double", "0.0", "parse_double(value)"};
+    }
+    if (fix_type == "CHAR") {
+        return {"char", "'\\0'", "value.empty() ? '\\0' : value[0]"};
+    }
+    if (fix_type == "BOOLEAN") {
+        return {"bool", "false", "value == \"Y\""};
+    }
+    return {"std::string_view", "", "value"};
+}
+
+// "ClOrdID" -> "cl_ord_id", "MsgSeqNum" -> "msg_seq_num"
+std::string snake_case(const std::string& name) {
+    std::string out;
+    for (size_t i = 0; i < name.size(); ++i) {
+        const char c = name[i];
+        const bool upper = std::isupper(static_cast<unsigned char>(c));
+        if (upper && i > 0) {
+            const bool prev_lower = std::islower(static_cast<unsigned char>(name[i - 1]));
+            const bool next_lower = i + 1 < name.size() &&
+                                    std::islower(static_cast<unsigned char>(name[i + 1]));
+            const bool prev_upper = std::isupper(static_cast<unsigned char>(name[i - 1]));
+            if (prev_lower || (prev_upper && next_lower)) {
+                out += '_';
+            }
+        }
+        out += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return out;
+}
+
+class Dictionary {
+public:
+    explicit Dictionary(const XmlElement& root) : root_(root) {
+        const XmlElement* fields = root.child("fields");
+        if (fields == nullptr) {
+            throw std::runtime_error("dictionary has no <fields> section");
+        }
+        for (const auto& field : fields->children) {
+            if (field->name != "field") {
+                continue;
+            }
+            FieldDef def{static_cast<uint32_t>(std::stoul(field->attribute("number"))),
+                         field->attribute("name"), field->attribute("type")};
+            fields_[def.name] = def;
+        }
+        if (const XmlElement* components = root.child("components")) {
+            for (const auto& component : components->children) {
+                components_[component->attribute("name")] = component.get();
+            }
+        }
+    }
+
+    std::vector<MessageDef> messages() const {
+        const XmlElement* messages = root_.child("messages");
+        if (messages == nullptr) {
+            throw std::runtime_error("dictionary has no <messages> section");
+        }
+
+        std::vector<MessageDef> out;
+        for (const auto& message : messages->children) {
+            MessageDef def{message->attribute("name"), message->attribute("msgtype"), {}, {}};
+            std::set<uint32_t> seen;
+            if (const XmlElement* header = root_.child("header")) {
+                collect(*header, true, def, seen);
+            }
+            collect(*message, true, def, seen);
+            out.push_back(std::move(def));
+        }
+        return out;
+    }
+
+private:
+    const FieldDef& field(const std::string& name) const {
+        auto it = fields_.find(name);
+        if (it == fields_.end()) {
+            throw std::runtime_error("undefined field " + name);
+        }
+        return it->second;
+    }
+
+    // Appends the fields of an element, inlining components. A field is only
+    // required if it and every enclosing component are.
+    void collect(const XmlElement& element, bool required, MessageDef& def,
+                 std::set<uint32_t>& seen) const {
+        for (const auto& item : element.children) {
+            const bool item_required = required && item->attribute("required") == "Y";
+            if (item->name == "field") {
+                const FieldDef& f = field(item->attribute("name"));
+                if (!FRAMING_TAGS.count(f.number) && seen.insert(f.number).second) {
+                    def.fields.push_back({&f, item_required});
+                }
+            } else if (item->name == "component") {
+                auto it = components_.find(item->attribute("name"));
+                if (it == components_.end()) {
+                    throw std::runtime_error("undefined component " + item->attribute("name"));
+                }
+                collect(*it->second, item_required, def, seen);
+            } else if (item->name == "group") {
+                def.skipped_groups.push_back(item->attribute("name"));
+            }
+        }
+    }
+
+    const XmlElement& root_;
+    std::map<std::string, FieldDef> fields_;
+    std::map<std::string, const XmlElement*> components_;
+};
+
+// ============================================================================
+// Code generation
+// ============================================================================
+
+void emit_message(std::ostream& out, const MessageDef& message) {
+    // One bit per slot in the required/present sets
+    const size_t mask_words = (message.fields.size() + 63) / 64;
+    uint32_t max_tag = 0;
+    std::vector<uint64_t> required_mask(mask_words);
+    for (size_t slot = 0; slot < message.fields.size(); ++slot) {
+        max_tag = std::max(max_tag, message.fields[slot].def->number);
+        if (message.fields[slot].required) {
+            required_mask[slot / 64] |= uint64_t{1} << (slot % 64);
+        }
+    }
+    // SLOTS holds slot + 1, so 255 fields still fit in a byte
+    const char* slot_type = message.fields.size() < 255 ? "uint8_t" : "uint16_t";
+
+    out << "/**\n * " << message.name << " (35=" << message.msg_type << ")\n";
+    if (!message.skipped_groups.empty()) {
+        out << " *\n * Repeating groups not generated:";
+        for (const std::string& group : message.skipped_groups) {
+            out << ' ' << group;
+        }
+        out << "\n";
+    }
+    out << " */\n";
+    out << "struct " << message.name << " {\n";
+    out << "    static constexpr std::string_view MSG_TYPE = \"" << message.msg_type << "\";\n";
+    out << "    static constexpr size_t FIELD_COUNT = " << message.fields.size() << ";\n";
+    out << "    static constexpr size_t MASK_WORDS = " << mask_words << ";\n";
+    out << "    static constexpr std::array<uint64_t, MASK_WORDS> REQUIRED_MASK = {";
+    for (size_t word = 0; word < mask_words; ++word) {
+        out << (word == 0 ? "" : ", ") << "0x" << std::hex << required_mask[word] << std::dec;
+    }
+    out << "};\n\n";
+
+    for (const MessageField& field : message.fields) {
+        const CppType type = cpp_type(field.def->type);
+        out << "    " << type.type << ' ' << snake_case(field.def->name) << '{' << type.init
+            << "};  // " << field.def->number << ' ' << field.def->name
+            << (field.required ? " (required)" : "") << "\n";
+    }
+
+    out << "\n    std::array<uint64_t, MASK_WORDS> present{};  // Bit per slot, set when the field was seen\n\n";
+
+    out << "    static constexpr std::array<" << slot_type << ", " << max_tag + 1 << "> SLOTS = [] {\n";
+    out << "        std::array<" << slot_type << ", " << max_tag + 1 << "> slots{};\n";
+    for (size_t slot = 0; slot < message.fields.size(); ++slot) {
+        out << "        slots[" << message.fields[slot].def->number << "] = " << slot + 1 << ";\n";
+    }
+    out << "        return slots;\n    }();\n\n";
+
+    out << "    void set(size_t slot, std::string_view value) {\n";
+    out << "        switch (slot) {\n";
+    for (size_t slot = 0; slot < message.fields.size(); ++slot) {
+        const MessageField& field = message.fields[slot];
+        out << "            case " << slot << ": " << snake_case(field.def->name) << " = "
+            << cpp_type(field.def->type).conversion << "; break;\n";
+    }
+    out << "            default: return;\n";
+    out << "        }\n";
+    out << "        present[slot / 64] |= uint64_t{1} << (slot % 64);\n";
+    out << "    }\n\n";
+
+    out << "    bool has_required() const {\n";
+    out << "        for (size_t word = 0; word < MASK_WORDS; ++word) {\n";
+    out << "            if ((present[word] & REQUIRED_MASK[word]) != REQUIRED_MASK[word]) {\n";
+    out << "                return false;\n";
+    out << "            }\n";
+    out << "        }\n";
+    out << "        return true;\n";
+    out << "    }\n";
+    out << "};\n\n";
+}
+
+void emit_header(std::ostream& out, const std::vector<MessageDef>& messages,
+                 const std::string& source, const std::string& name_space) {
+    out << "// Generated by fix_codegen from " << source << ". Do not edit.\n";
+    out << "#pragma once\n\n";
+    out << "#include \"dictionary_parser.hpp\"\n";
+    out << "#include <array>\n#include <cstddef>\n#include <cstdint>\n#include <string_view>\n\n";
+    out << "namespace simd_parser::" << name_space << " {\n\n";
+    for (const MessageDef& message : messages) {
+        emit_message(out, message);
+    }
+    out << "} // namespace simd_parser::" << name_space << "\n";
+}
+
+std::string read_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("cannot open " + path);
+    }
+    std::ostringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <dictionary.xml> <output.hpp> <namespace>\n";
+        return 1;
+    }
+    const std::string input = argv[1];
+    const std::string output = argv[2];
+
+    try {
+        auto root = XmlReader(read_file(input)).parse_document();
+        Dictionary dictionary(*root);
+
+        std::ostringstream generated;
+        const std::string source = input.substr(input.find_last_of('/') + 1);
+        emit_header(generated, dictionary.messages(), source, argv[3]);
+
+        std::ofstream out(output, std::ios::binary);
+        if (!out) {
+            throw std::runtime_error("cannot write " + output);
+        }
+        out << generated.str();
+    } catch (const std::exception& e) {
+        std::cerr << input << ": " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}